@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: BSL-1.0
 
 #include <SoapySDR/Device.hpp>
+#include <SoapySDR/Buffers.hpp>
 #include <SoapySDR/Formats.hpp>
 #include <SoapySDR/Errors.hpp>
 #include <string>
@@ -27,9 +28,8 @@ void runRateTestStreamLoop(
 {
     //allocate buffers for the stream read/write
     const size_t numElems = device->getStreamMTU(stream);
-    std::vector<std::vector<char>> buffMem(numChans, std::vector<char>(elemSize*numElems));
-    std::vector<void *> buffs(numChans);
-    for (size_t i = 0; i < numChans; i++) buffs[i] = buffMem[i].data();
+    SoapySDR::BufferPool buffMem(numChans, elemSize*numElems, SOAPY_SDR_BUFFER_HUGE_PAGES | SOAPY_SDR_BUFFER_NUMA_LOCAL);
+    void * const *buffs = buffMem.getBuffers();
 
     //state collected in this loop
     unsigned int overflows(0);
@@ -52,10 +52,10 @@ void runRateTestStreamLoop(
         switch(direction)
         {
         case SOAPY_SDR_RX:
-            ret = device->readStream(stream, buffs.data(), numElems, flags, timeNs);
+            ret = device->readStream(stream, buffs, numElems, flags, timeNs);
             break;
         case SOAPY_SDR_TX:
-            ret = device->writeStream(stream, buffs.data(), numElems, flags, timeNs);
+            ret = device->writeStream(stream, buffs, numElems, flags, timeNs);
             break;
         }
 
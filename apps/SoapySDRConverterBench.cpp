@@ -0,0 +1,266 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Version.hpp>
+#include <SoapySDR/Modules.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <cstdlib>
+#include <cstdint>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <getopt.h>
+
+/***********************************************************************
+ * Print help message
+ **********************************************************************/
+static int printHelp(void)
+{
+    std::cout << "Usage SoapySDRConverterBench [options]" << std::endl;
+    std::cout << "  Measure the throughput of every registered converter" << std::endl;
+    std::cout << "  and print the results as JSON." << std::endl;
+    std::cout << std::endl;
+    std::cout << "  Options summary:" << std::endl;
+    std::cout << "    --help \t\t\t\t Print this help message" << std::endl;
+    std::cout << "    --source[=CS16|CF32|...] \t\t Only measure this source format" << std::endl;
+    std::cout << "    --target[=CS16|CF32|...] \t\t Only measure this target format" << std::endl;
+    std::cout << "    --sizes[=\"256, 65536, ...\"] \t List of buffer sizes in elements" << std::endl;
+    std::cout << "    --time[=seconds] \t\t\t Minimum time per measurement" << std::endl;
+    std::cout << "    --scaler[=1.0] \t\t\t Scale factor passed to the converters" << std::endl;
+    std::cout << "    --output[=file.json] \t\t Write the results to a file" << std::endl;
+    std::cout << std::endl;
+    return EXIT_SUCCESS;
+}
+
+/***********************************************************************
+ * Helpers
+ **********************************************************************/
+static std::vector<size_t> parseSizes(const std::string &sizesStr)
+{
+    std::vector<size_t> sizes;
+    std::stringstream ss(sizesStr);
+    std::string size;
+    while (std::getline(ss, size, ','))
+    {
+        const size_t numElems = std::strtoull(size.c_str(), nullptr, 10);
+        if (numElems != 0) sizes.push_back(numElems);
+    }
+    return sizes;
+}
+
+static std::string toJsonString(const std::string &s)
+{
+    std::string out("\"");
+    for (const char ch : s)
+    {
+        if (ch == '"' or ch == '\\') out += '\\';
+        if (static_cast<unsigned char>(ch) < 0x20) continue;
+        out += ch;
+    }
+    return out + "\"";
+}
+
+//fill the buffer with representative samples:
+//floating point samples stay within full scale to avoid denormals and NaNs
+static void fillBuffer(std::vector<char> &buff, const std::string &format)
+{
+    uint32_t state(0x12345678);
+    auto next = [&state](void){state = state*1664525 + 1013904223; return state;};
+
+    if (format == SOAPY_SDR_F32 or format == SOAPY_SDR_CF32)
+    {
+        auto p = reinterpret_cast<float *>(buff.data());
+        for (size_t i = 0; i < buff.size()/sizeof(float); i++) p[i] = float(int32_t(next()))/2147483648.0f;
+    }
+    else if (format == SOAPY_SDR_F64 or format == SOAPY_SDR_CF64)
+    {
+        auto p = reinterpret_cast<double *>(buff.data());
+        for (size_t i = 0; i < buff.size()/sizeof(double); i++) p[i] = double(int32_t(next()))/2147483648.0;
+    }
+    else for (auto &b : buff) b = char(next() >> 24);
+}
+
+struct Measurement
+{
+    size_t numElems;
+    size_t bytes;
+    double nsPerSample;
+    double gigabytesPerSec;
+};
+
+static Measurement measure(
+    const SoapySDR::PreparedConverter &converter,
+    const size_t numElems,
+    const double minTime)
+{
+    std::vector<char> src(converter.getSourceElemSize()*numElems);
+    std::vector<char> dst(converter.getTargetElemSize()*numElems);
+    fillBuffer(src, converter.getSourceFormat());
+
+    //warm up the caches and the branch predictor
+    converter.convert(src.data(), dst.data(), numElems);
+
+    //double the batch size until the batch runs for the minimum time
+    size_t iters(1);
+    double elapsed(0.0);
+    while (true)
+    {
+        const auto t0 = std::chrono::high_resolution_clock::now();
+        for (size_t i = 0; i < iters; i++) converter.convert(src.data(), dst.data(), numElems);
+        const auto t1 = std::chrono::high_resolution_clock::now();
+        elapsed = std::chrono::duration<double>(t1-t0).count();
+        if (elapsed >= minTime) break;
+        iters *= 2;
+    }
+
+    Measurement m;
+    m.numElems = numElems;
+    m.bytes = src.size() + dst.size();
+    m.nsPerSample = (elapsed*1e9)/(double(iters)*numElems);
+    m.gigabytesPerSec = (double(iters)*m.bytes)/(elapsed*1e9);
+    return m;
+}
+
+/***********************************************************************
+ * main benchmark entry point
+ **********************************************************************/
+int main(int argc, char *argv[])
+{
+    std::string sourceFilter;
+    std::string targetFilter;
+    std::string outputFile;
+    double minTime(0.05);
+    double scaler(1.0);
+
+    //default sizes step from within L1 out to main memory
+    std::vector<size_t> sizes{1 << 8, 1 << 12, 1 << 16, 1 << 20, 1 << 22};
+
+    /*******************************************************************
+     * parse command line options
+     ******************************************************************/
+    static struct option long_options[] = {
+        {"help", no_argument, nullptr, 'h'},
+        {"source", optional_argument, nullptr, 's'},
+        {"target", optional_argument, nullptr, 't'},
+        {"sizes", optional_argument, nullptr, 'n'},
+        {"time", optional_argument, nullptr, 'd'},
+        {"scaler", optional_argument, nullptr, 'c'},
+        {"output", optional_argument, nullptr, 'o'},
+        {nullptr, no_argument, nullptr, '\0'}
+    };
+    int long_index = 0;
+    int option = 0;
+    while ((option = getopt_long_only(argc, argv, "", long_options, &long_index)) != -1)
+    {
+        switch (option)
+        {
+        case 'h': return printHelp();
+        case 's':
+            if (optarg != nullptr) sourceFilter = optarg;
+            break;
+        case 't':
+            if (optarg != nullptr) targetFilter = optarg;
+            break;
+        case 'n':
+            if (optarg != nullptr) sizes = parseSizes(optarg);
+            break;
+        case 'd':
+            if (optarg != nullptr) minTime = std::stod(optarg);
+            break;
+        case 'c':
+            if (optarg != nullptr) scaler = std::stod(optarg);
+            break;
+        case 'o':
+            if (optarg != nullptr) outputFile = optarg;
+            break;
+        default: return printHelp();
+        }
+    }
+
+    if (sizes.empty())
+    {
+        std::cerr << "No valid buffer sizes specified" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    /*******************************************************************
+     * measure every source, target, and priority
+     ******************************************************************/
+    //load modules so that their converters are measured as well
+    SoapySDR::loadModules();
+
+    std::stringstream json;
+    json << "{" << std::endl;
+    json << "  \"libVersion\": " << toJsonString(SoapySDR::getLibVersion()) << "," << std::endl;
+    json << "  \"abiVersion\": " << toJsonString(SoapySDR::getABIVersion()) << "," << std::endl;
+    json << "  \"scaler\": " << scaler << "," << std::endl;
+    json << "  \"minTime\": " << minTime << "," << std::endl;
+    json << "  \"converters\": [";
+
+    bool firstConverter(true);
+    for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+    {
+        if (not sourceFilter.empty() and source != sourceFilter) continue;
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+        {
+            if (not targetFilter.empty() and target != targetFilter) continue;
+
+            //the buffers are sized from the formats, so custom formats without a known size are skipped
+            if (SoapySDR::formatToSize(source) == 0 or SoapySDR::formatToSize(target) == 0)
+            {
+                std::cerr << source << " -> " << target << " skipped, unknown format size" << std::endl;
+                continue;
+            }
+            for (const auto &priority : SoapySDR::ConverterRegistry::listPriorities(source, target))
+            {
+                const SoapySDR::PreparedConverter converter(source, target, priority, scaler);
+                std::cerr << source << " -> " << target << " priority " << priority
+                    << " (" << converter.getInstructionSet() << ")" << std::endl;
+
+                json << (firstConverter?"":",") << std::endl;
+                firstConverter = false;
+                json << "    {" << std::endl;
+                json << "      \"source\": " << toJsonString(source) << "," << std::endl;
+                json << "      \"target\": " << toJsonString(target) << "," << std::endl;
+                json << "      \"priority\": " << priority << "," << std::endl;
+                json << "      \"instructionSet\": " << toJsonString(converter.getInstructionSet()) << "," << std::endl;
+                json << "      \"measurements\": [";
+                for (size_t i = 0; i < sizes.size(); i++)
+                {
+                    const auto m = measure(converter, sizes[i], minTime);
+                    json << (i == 0?"":",") << std::endl;
+                    json << "        {\"numElems\": " << m.numElems
+                        << ", \"bytes\": " << m.bytes
+                        << ", \"nsPerSample\": " << m.nsPerSample
+                        << ", \"gigabytesPerSec\": " << m.gigabytesPerSec << "}";
+                }
+                json << std::endl << "      ]" << std::endl;
+                json << "    }";
+            }
+        }
+    }
+    json << std::endl << "  ]" << std::endl;
+    json << "}" << std::endl;
+
+    /*******************************************************************
+     * write the results
+     ******************************************************************/
+    if (outputFile.empty())
+    {
+        std::cout << json.str();
+        return EXIT_SUCCESS;
+    }
+
+    std::ofstream out(outputFile);
+    out << json.str();
+    if (not out)
+    {
+        std::cerr << "Failed to write " << outputFile << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -63,6 +63,7 @@ static int printHelp(void)
     std::cout << "    --check[=driverName] \t\t Check if driver is present" << std::endl;
     std::cout << "    --sparse             \t\t Simplified output for --find" << std::endl;
     std::cout << "    --serial=ABCD123456  \t\t Specify device serial number" << std::endl;
+    std::cout << "    --tune-converters    \t\t Save the fastest converters to the wisdom file" << std::endl;
     std::cout << std::endl;
 
     std::cout << "  Rate testing options:" << std::endl;
@@ -139,6 +140,37 @@ static int printInfo(void)
     return EXIT_SUCCESS;
 }
 
+/***********************************************************************
+ * Tune the converters and save the wisdom file
+ **********************************************************************/
+static int tuneConverters(void)
+{
+    //load modules so that their converters are tuned as well
+    SoapySDR::loadModules();
+
+    const auto path = SoapySDR::ConverterRegistry::getWisdomPath();
+    std::cout << "Tuning converters..." << std::endl;
+    SoapySDR::ConverterRegistry::tune();
+    for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+    {
+        for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+        {
+            if (SoapySDR::ConverterRegistry::listPriorities(source, target).size() < 2) continue;
+            const auto priority = SoapySDR::ConverterRegistry::getSelectedPriority(source, target);
+            std::cout << " - " << std::setw(5) << source << " -> " << std::setw(5) << target << " priority " << priority
+                << " (" << SoapySDR::ConverterRegistry::getInstructionSet(source, target, priority) << ")" << std::endl;
+        }
+    }
+
+    if (not SoapySDR::ConverterRegistry::saveWisdom(path))
+    {
+        std::cerr << "Failed to save wisdom file " << path << std::endl;
+        return EXIT_FAILURE;
+    }
+    std::cout << "Saved wisdom file " << path << std::endl;
+    return EXIT_SUCCESS;
+}
+
 /***********************************************************************
  * Find devices and print args
  **********************************************************************/
@@ -310,6 +342,7 @@ int main(int argc, char *argv[])
         {"check", optional_argument, nullptr, 'c'},
         {"sparse", no_argument, nullptr, 's'},
         {"serial", required_argument, nullptr, 'S'},
+        {"tune-converters", no_argument, nullptr, 'T'},
 
         {"args", optional_argument, nullptr, 'a'},
         {"rate", optional_argument, nullptr, 'r'},
@@ -355,6 +388,9 @@ int main(int argc, char *argv[])
         case 'S':
             serial = optarg;
             break;
+        case 'T':
+            printBanner();
+            return tuneConverters();
         case 'a':
             if (optarg != nullptr) argStr = optarg;
             break;
@@ -0,0 +1,242 @@
+///
+/// \file SoapySDR/BufferedStreams.hpp
+///
+/// Stream wrappers that move device I/O onto a dedicated thread.
+/// BufferedRxStream buffers a receive stream and
+/// BufferedTxStream buffers a transmit stream.
+///
+/// \copyright
+/// Copyright (c) 2026 SoapySDR contributors
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/Device.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace SoapySDR
+{
+/*!
+ * BufferedRxStream class. A BufferedRxStream reads from a receive stream
+ * on a dedicated thread into a lock-free single-producer/single-consumer
+ * ring of chunks, so the application may stall for the depth of the ring
+ * without the driver overflowing. The reader thread uses the direct buffer
+ * access API when the stream provides it, and readStream() otherwise.
+ *
+ * Each chunk holds up to one stream MTU of samples with the flags and time
+ * of the device read. When the ring is full, the reader thread keeps draining
+ * the device and drops the samples; the gap is reported by read() in stream
+ * order as SOAPY_SDR_OVERFLOW, the same as an overflow of the driver.
+ *
+ * The device and stream are used but not owned, and the stream
+ * must not be read by the application while the wrapper is active.
+ */
+class SOAPY_SDR_API BufferedRxStream
+{
+public:
+
+    /*!
+     * Create a buffered wrapper for an open receive stream.
+     * \throws invalid_argument when the format size is unknown
+     * \throws runtime_error when the ring allocation fails
+     * \param device a pointer to a device instance
+     * \param stream the opaque pointer to a receive stream handle
+     * \param format the format the stream was setup with, example "CS16"
+     * \param numChans the number of channels the stream was setup with
+     * \param numChunks the depth of the ring in stream MTUs
+     * \param bufferFlags optional SOAPY_SDR_BUFFER_* flags for the ring memory
+     */
+    BufferedRxStream(
+        Device *device,
+        Stream *stream,
+        const std::string &format,
+        const size_t numChans,
+        const size_t numChunks = 256,
+        const int bufferFlags = 0);
+
+    //! Deactivate the stream when active and free the ring
+    ~BufferedRxStream(void);
+
+    BufferedRxStream(const BufferedRxStream &) = delete;
+    BufferedRxStream &operator=(const BufferedRxStream &) = delete;
+
+    /*!
+     * Activate the stream and start the reader thread.
+     * The arguments are passed to Device::activateStream().
+     * \return 0 for success or the error code from activateStream()
+     */
+    int activate(const int flags = 0, const long long timeNs = 0, const size_t numElems = 0);
+
+    /*!
+     * Stop the reader thread and deactivate the stream.
+     * Samples that are already in the ring can still be read.
+     * The arguments are passed to Device::deactivateStream().
+     * \return 0 for success or the error code from deactivateStream()
+     */
+    int deactivate(const int flags = 0, const long long timeNs = 0);
+
+    //! Get the maximum number of elements in one chunk of the ring
+    size_t getMTU(void) const;
+
+    /*!
+     * Read elements from the ring.
+     * A read never spans chunks, so the flags and time apply to all elements.
+     * When the read consumes only part of a chunk, SOAPY_SDR_MORE_FRAGMENTS
+     * is set and the next read returns the remainder without SOAPY_SDR_HAS_TIME.
+     * Read with at least getMTU() elements to keep a time on every read.
+     * \param buffs an array of void* buffers num chans in size
+     * \param numElems the number of elements in each buffer
+     * \param flags optional flag indicators about the result
+     * \param timeNs the buffer's timestamp in nanoseconds
+     * \param timeoutUs the timeout in microseconds
+     * \return the number of elements read per buffer,
+     * SOAPY_SDR_OVERFLOW for a gap before the next elements,
+     * SOAPY_SDR_TIMEOUT when the ring stays empty,
+     * or the error that stopped the reader thread once the ring is empty
+     */
+    int read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs = 100000);
+
+    /*!
+     * Access the unread elements of the oldest chunk in place, without a copy.
+     * The buffers stay valid until release(); the flags and time follow read().
+     * \param buffs an array of const void* num chans in size, set to the unread elements
+     * \param flags optional flag indicators about the result
+     * \param timeNs the buffer's timestamp in nanoseconds
+     * \param timeoutUs the timeout in microseconds
+     * \return the number of unread elements per buffer or an error code like read()
+     */
+    int acquire(const void **buffs, int &flags, long long &timeNs, const long timeoutUs = 100000);
+
+    /*!
+     * Consume elements of the chunk from acquire().
+     * \param numElems the number of elements consumed, up to the acquire() result
+     */
+    void release(const size_t numElems);
+
+    //! Get the number of overflows from the driver and from a full ring
+    size_t getNumOverflows(void) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+/*!
+ * BufferedTxStream class. A BufferedTxStream queues samples for a transmit
+ * stream in a lock-free single-producer/single-consumer ring of chunks,
+ * and a dedicated thread writes the chunks to the device, so the application
+ * may produce samples in large batches without real-time constraints.
+ *
+ * Samples written before activate() prefill the ring, so the device is fed
+ * from the first moment of activation. Each chunk keeps the flags and time of
+ * its write() call, so timed bursts with SOAPY_SDR_HAS_TIME and
+ * SOAPY_SDR_END_BURST can be queued ahead of time.
+ *
+ * Errors from writeStream() and the stream status of the driver are reported
+ * through readStatus(). Underflows are only those the driver reports; the ring
+ * running dry in the middle of a burst is counted by getNumStarvations().
+ *
+ * The device and stream are used but not owned, and the stream
+ * must not be written by the application while the wrapper is active.
+ */
+class SOAPY_SDR_API BufferedTxStream
+{
+public:
+
+    /*!
+     * Create a buffered wrapper for an open transmit stream.
+     * \throws invalid_argument when the format size is unknown
+     * \throws runtime_error when the ring allocation fails
+     * \param device a pointer to a device instance
+     * \param stream the opaque pointer to a transmit stream handle
+     * \param format the format the stream was setup with, example "CS16"
+     * \param numChans the number of channels the stream was setup with
+     * \param numChunks the depth of the ring in stream MTUs
+     * \param bufferFlags optional SOAPY_SDR_BUFFER_* flags for the ring memory
+     */
+    BufferedTxStream(
+        Device *device,
+        Stream *stream,
+        const std::string &format,
+        const size_t numChans,
+        const size_t numChunks = 256,
+        const int bufferFlags = 0);
+
+    //! Deactivate the stream when active and free the ring
+    ~BufferedTxStream(void);
+
+    BufferedTxStream(const BufferedTxStream &) = delete;
+    BufferedTxStream &operator=(const BufferedTxStream &) = delete;
+
+    /*!
+     * Activate the stream and start the writer thread,
+     * which begins with the samples that prefill the ring.
+     * The arguments are passed to Device::activateStream().
+     * \return 0 for success or the error code from activateStream()
+     */
+    int activate(const int flags = 0, const long long timeNs = 0, const size_t numElems = 0);
+
+    /*!
+     * Stop the writer thread and deactivate the stream.
+     * Samples that were not written yet stay in the ring;
+     * call flush() first to wait for the ring to drain.
+     * The arguments are passed to Device::deactivateStream().
+     * \return 0 for success or the error code from deactivateStream()
+     */
+    int deactivate(const int flags = 0, const long long timeNs = 0);
+
+    //! Get the maximum number of elements in one chunk of the ring
+    size_t getMTU(void) const;
+
+    /*!
+     * Queue elements for transmission.
+     * The elements fill as many chunks as the ring has room for.
+     * SOAPY_SDR_HAS_TIME applies to the first element and
+     * SOAPY_SDR_END_BURST only when every element was queued.
+     * \param buffs an array of void* buffers num chans in size
+     * \param numElems the number of elements in each buffer
+     * \param flags optional input flags
+     * \param timeNs the buffer's timestamp in nanoseconds
+     * \param timeoutUs the timeout in microseconds to wait for room
+     * \return the number of elements queued per buffer or SOAPY_SDR_TIMEOUT
+     */
+    int write(const void * const *buffs, const size_t numElems, const int flags = 0, const long long timeNs = 0, const long timeoutUs = 100000);
+
+    /*!
+     * Wait for the writer thread to write every queued element to the device.
+     * \param timeoutUs the timeout in microseconds
+     * \return 0 when the ring is empty or SOAPY_SDR_TIMEOUT
+     */
+    int flush(const long timeoutUs = 100000);
+
+    /*!
+     * Readback status information about the stream.
+     * Events of the writer thread are reported first, and the stream
+     * status of the driver is forwarded from Device::readStreamStatus().
+     * \param chanMask to which channels this status applies
+     * \param flags optional output flags
+     * \param timeNs the timestamp of the event in nanoseconds
+     * \param timeoutUs the timeout in microseconds
+     * \return 0 for success or error code like SOAPY_SDR_UNDERFLOW
+     */
+    int readStatus(size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs = 100000);
+
+    //! Get the number of underflows reported by the driver
+    size_t getNumUnderflows(void) const;
+
+    /*!
+     * Get the number of times the ring ran dry in the middle of a burst.
+     * The device may still have had samples queued, so this is not an underflow,
+     * but it shows that the application did not keep ahead of the writer thread.
+     */
+    size_t getNumStarvations(void) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}
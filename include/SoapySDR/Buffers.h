@@ -0,0 +1,99 @@
+///
+/// \file SoapySDR/Buffers.h
+///
+/// Allocate aligned sample buffers for streaming.
+///
+/// \copyright
+/// Copyright (c) 2026 SoapySDR contributors
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.h>
+#include <SoapySDR/Device.h>
+#include <stddef.h>
+
+/*!
+ * The alignment in bytes of every buffer in a buffer pool.
+ * This covers a cache line and the widest SIMD registers.
+ */
+#define SOAPY_SDR_BUFFER_ALIGNMENT 64
+
+/*!
+ * Back the buffers with huge pages to reduce TLB misses at high sample rates.
+ * Falls back to normal pages when no huge pages are reserved by the system.
+ */
+#define SOAPY_SDR_BUFFER_HUGE_PAGES (1 << 0)
+
+/*!
+ * Lock the buffers into memory so that they are never paged out.
+ * The lock may fail when it exceeds the process limit on locked memory.
+ */
+#define SOAPY_SDR_BUFFER_LOCKED (1 << 1)
+
+/*!
+ * Place the buffers on the NUMA node of the calling thread.
+ * Allocate from the thread that will stream with the buffers.
+ */
+#define SOAPY_SDR_BUFFER_NUMA_LOCAL (1 << 2)
+
+//! An opaque handle to a pool of sample buffers
+typedef struct SoapySDRBufferPool SoapySDRBufferPool;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*!
+ * Allocate a pool of equally sized buffers.
+ * \param numBuffs the number of buffers in the pool
+ * \param numBytes the size of each buffer in bytes
+ * \param flags optional SOAPY_SDR_BUFFER_* allocation flags
+ * \return a pointer to a new buffer pool or NULL on error
+ */
+SOAPY_SDR_API SoapySDRBufferPool *SoapySDRBufferPool_make(const size_t numBuffs, const size_t numBytes, const int flags);
+
+/*!
+ * Allocate a pool of buffers that each hold one stream MTU of the given format.
+ * \param device a pointer to a device instance
+ * \param stream the opaque pointer to a stream handle
+ * \param format the stream format markup string, example "CF32"
+ * \param numBuffs the number of buffers in the pool, example one per channel
+ * \param flags optional SOAPY_SDR_BUFFER_* allocation flags
+ * \return a pointer to a new buffer pool or NULL on error
+ */
+SOAPY_SDR_API SoapySDRBufferPool *SoapySDRBufferPool_makeForStream(const SoapySDRDevice *device, SoapySDRStream *stream, const char *format, const size_t numBuffs, const int flags);
+
+/*!
+ * Free the buffers and the pool.
+ * \param pool a pointer to a buffer pool
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRBufferPool_unmake(SoapySDRBufferPool *pool);
+
+/*!
+ * Get the buffers of the pool.
+ * The array can be passed directly to readStream() and writeStream().
+ * \param pool a pointer to a buffer pool
+ * \param [out] length the number of buffers
+ * \return an array of buffer pointers owned by the pool
+ */
+SOAPY_SDR_API void **SoapySDRBufferPool_getBuffers(SoapySDRBufferPool *pool, size_t *length);
+
+/*!
+ * Get the size of each buffer in the pool.
+ * \param pool a pointer to a buffer pool
+ * \return the size of each buffer in bytes
+ */
+SOAPY_SDR_API size_t SoapySDRBufferPool_getNumBytes(const SoapySDRBufferPool *pool);
+
+/*!
+ * Get the allocation flags that took effect.
+ * \param pool a pointer to a buffer pool
+ * \return the subset of the requested SOAPY_SDR_BUFFER_* flags
+ */
+SOAPY_SDR_API int SoapySDRBufferPool_getFlags(const SoapySDRBufferPool *pool);
+
+#ifdef __cplusplus
+}
+#endif
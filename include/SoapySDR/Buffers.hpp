@@ -0,0 +1,122 @@
+///
+/// \file SoapySDR/Buffers.hpp
+///
+/// Allocate aligned sample buffers for streaming.
+///
+/// \copyright
+/// Copyright (c) 2026 SoapySDR contributors
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/Buffers.h>
+#include <SoapySDR/Device.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace SoapySDR
+{
+/*!
+ * BufferPool class. A BufferPool owns equally sized sample buffers
+ * allocated from a single mapping. Every buffer is aligned to
+ * SOAPY_SDR_BUFFER_ALIGNMENT, so converters and drivers can rely
+ * on aligned loads. The allocation flags optionally request
+ * huge pages, locked memory, and NUMA-local placement;
+ * flags that the system cannot honor are dropped, see getFlags().
+ * The buffers are freed when the pool is destroyed.
+ */
+class SOAPY_SDR_API BufferPool
+{
+public:
+
+    //! Create an empty pool without buffers
+    BufferPool(void);
+
+    /*!
+     * Allocate a pool of equally sized buffers.
+     * \throws invalid_argument when the buffer size is zero
+     * \throws runtime_error when the allocation fails
+     * \param numBuffs the number of buffers in the pool
+     * \param numBytes the size of each buffer in bytes
+     * \param flags optional SOAPY_SDR_BUFFER_* allocation flags
+     */
+    BufferPool(const size_t numBuffs, const size_t numBytes, const int flags = 0);
+
+    //! Free the buffers
+    ~BufferPool(void);
+
+    //! Take the buffers of another pool, which is left empty
+    BufferPool(BufferPool &&other);
+
+    //! Free the buffers and take the buffers of another pool, which is left empty
+    BufferPool &operator=(BufferPool &&other);
+
+    BufferPool(const BufferPool &) = delete;
+    BufferPool &operator=(const BufferPool &) = delete;
+
+    //! Get the number of buffers in the pool
+    size_t getNumBuffers(void) const;
+
+    //! Get the size of each buffer in bytes
+    size_t getNumBytes(void) const;
+
+    //! Get the subset of the requested allocation flags that took effect
+    int getFlags(void) const;
+
+    //! Get a buffer by index
+    void *getBuffer(const size_t index) const;
+
+    //! Get the buffers as an array for readStream() and writeStream()
+    void * const *getBuffers(void) const;
+
+private:
+    void release(void);
+
+    void *_mem;
+    size_t _memBytes;
+    size_t _numBytes;
+    int _flags;
+    std::vector<void *> _buffs;
+};
+
+/*!
+ * Allocate a pool of buffers that each hold one stream MTU of the given format.
+ * \throws invalid_argument when the format size is unknown
+ * \throws runtime_error when the allocation fails
+ * \param device a pointer to a device instance
+ * \param stream the opaque pointer to a stream handle
+ * \param format the stream format markup string, example "CF32"
+ * \param numBuffs the number of buffers in the pool, example one per channel
+ * \param flags optional SOAPY_SDR_BUFFER_* allocation flags
+ * \return a pool of numBuffs buffers of getStreamMTU() elements
+ */
+SOAPY_SDR_API BufferPool allocateBuffers(const Device *device, Stream *stream, const std::string &format, const size_t numBuffs, const int flags = 0);
+
+}
+
+inline size_t SoapySDR::BufferPool::getNumBuffers(void) const
+{
+    return _buffs.size();
+}
+
+inline size_t SoapySDR::BufferPool::getNumBytes(void) const
+{
+    return _numBytes;
+}
+
+inline int SoapySDR::BufferPool::getFlags(void) const
+{
+    return _flags;
+}
+
+inline void *SoapySDR::BufferPool::getBuffer(const size_t index) const
+{
+    return _buffs.at(index);
+}
+
+inline void * const *SoapySDR::BufferPool::getBuffers(void) const
+{
+    return _buffs.data();
+}
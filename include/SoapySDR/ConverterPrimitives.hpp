@@ -24,6 +24,8 @@ const uint8_t   S8_FULL_SCALE =  uint8_t(1<<7);
   
 /*!
  * Conversion Primitives for converting real values between Soapy formats.
+ * Floating point to integer conversions saturate to the integer range,
+ * and NaN maps to the most negative integer like the vectorized converters.
  * \param from the value to convert from
  * \return the converted value
  */
@@ -31,26 +33,66 @@ const uint8_t   S8_FULL_SCALE =  uint8_t(1<<7);
 // type conversion: float <> signed integers
 
 inline int32_t F32toS32(float from){
-  return int32_t(from * S32_FULL_SCALE);
+  //the largest int32 is not representable as a float, compare against 2^31
+  const float x = from * S32_FULL_SCALE;
+  if (x >= 2147483648.0f) return int32_t(0x7fffffff);
+  return (x >= -2147483648.0f)?int32_t(x):int32_t(-2147483647-1);
 }
 inline float S32toF32(int32_t from){
   return float(from) / S32_FULL_SCALE;
 }
 
 inline int16_t F32toS16(float from){
-  return int16_t(from * S16_FULL_SCALE);
+  const float x = from * S16_FULL_SCALE;
+  return int16_t((x > 32767.0f)?32767.0f:((x >= -32768.0f)?x:-32768.0f));
 }
 inline float S16toF32(int16_t from){
   return float(from) / S16_FULL_SCALE;
 }
 
 inline int8_t F32toS8(float from){
-  return int8_t(from * S8_FULL_SCALE);
+  const float x = from * S8_FULL_SCALE;
+  return int8_t((x > 127.0f)?127.0f:((x >= -128.0f)?x:-128.0f));
 }
 inline float S8toF32(int8_t from){
   return float(from) / S8_FULL_SCALE;
 }
 
+// type conversion: double <> signed integers
+
+inline int32_t F64toS32(double from){
+  const double x = from * S32_FULL_SCALE;
+  return int32_t((x > 2147483647.0)?2147483647.0:((x >= -2147483648.0)?x:-2147483648.0));
+}
+inline double S32toF64(int32_t from){
+  return double(from) / S32_FULL_SCALE;
+}
+
+inline int16_t F64toS16(double from){
+  const double x = from * S16_FULL_SCALE;
+  return int16_t((x > 32767.0)?32767.0:((x >= -32768.0)?x:-32768.0));
+}
+inline double S16toF64(int16_t from){
+  return double(from) / S16_FULL_SCALE;
+}
+
+inline int8_t F64toS8(double from){
+  const double x = from * S8_FULL_SCALE;
+  return int8_t((x > 127.0)?127.0:((x >= -128.0)?x:-128.0));
+}
+inline double S8toF64(int8_t from){
+  return double(from) / S8_FULL_SCALE;
+}
+
+// type conversion: float <> double
+
+inline double F32toF64(float from){
+  return double(from);
+}
+inline float F64toF32(double from){
+  return float(from);
+}
+
 
 // type conversion: offset binary <> two's complement (signed) integers
 
@@ -94,6 +136,33 @@ inline int16_t S8toS16(int8_t from){
   return int16_t(from << 8);
 }
 
+// byte order conversion: big endian (network order) <> host order
+// these swap the bytes on little endian hosts and pass through on big endian hosts
+
+inline int32_t S32BEtoS32(int32_t from){
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  return from;
+#else
+  const uint32_t x = uint32_t(from);
+  return int32_t((x << 24) | ((x << 8) & 0x00ff0000) | ((x >> 8) & 0x0000ff00) | (x >> 24));
+#endif
+}
+inline int32_t S32toS32BE(int32_t from){
+  return S32BEtoS32(from);
+}
+
+inline int16_t S16BEtoS16(int16_t from){
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+  return from;
+#else
+  const uint16_t x = uint16_t(from);
+  return int16_t((x << 8) | (x >> 8));
+#endif
+}
+inline int16_t S16toS16BE(int16_t from){
+  return S16BEtoS16(from);
+}
+
 // compound conversions
 
 // float <> unsigned (type and size)
@@ -149,5 +218,65 @@ inline int8_t U16toS8(uint16_t from){
   return S16toS8(U16toS16(from));
 }
 
+// float <> big endian signed (type and byte order)
+
+inline int32_t F32toS32BE(float from){
+  return S32toS32BE(F32toS32(from));
+}
+inline float S32BEtoF32(int32_t from){
+  return S32toF32(S32BEtoS32(from));
+}
+
+inline int16_t F32toS16BE(float from){
+  return S16toS16BE(F32toS16(from));
+}
+inline float S16BEtoF32(int16_t from){
+  return S16toF32(S16BEtoS16(from));
+}
+
+// packed conversion: complex 12-bit (3 bytes) <> complex 16-bit
+// the 24-bit little endian word holds I in bits 0-11 and Q in bits 12-23
+// the 16-bit values are left justified, as with the other size conversions
+
+inline void CS12toCS16(const uint8_t *from, int16_t &i, int16_t &q){
+  i = int16_t((uint16_t(from[1]) << 12) | (uint16_t(from[0]) << 4));
+  q = int16_t((uint16_t(from[2]) << 8) | (uint16_t(from[1]) & 0xf0));
+}
+inline void CS16toCS12(int16_t i, int16_t q, uint8_t *to){
+  to[0] = uint8_t(uint16_t(i) >> 4);
+  to[1] = uint8_t((uint16_t(q) & 0xf0) | (uint16_t(i) >> 12));
+  to[2] = uint8_t(uint16_t(q) >> 8);
+}
+
+inline void CU12toCS16(const uint8_t *from, int16_t &i, int16_t &q){
+  CS12toCS16(from, i, q);
+  i = U16toS16(uint16_t(i));
+  q = U16toS16(uint16_t(q));
+}
+inline void CS16toCU12(int16_t i, int16_t q, uint8_t *to){
+  CS16toCS12(int16_t(S16toU16(i)), int16_t(S16toU16(q)), to);
+}
+
+// packed conversion: complex 4-bit (1 byte) <> complex 8-bit
+// the byte holds I in bits 0-3 and Q in bits 4-7
+// the 8-bit values are left justified, as with the other size conversions
+
+inline void CS4toCS8(uint8_t from, int8_t &i, int8_t &q){
+  i = int8_t(uint8_t(from << 4));
+  q = int8_t(from & 0xf0);
+}
+inline uint8_t CS8toCS4(int8_t i, int8_t q){
+  return uint8_t((uint8_t(i) >> 4) | (uint8_t(q) & 0xf0));
+}
+
+inline void CU4toCS8(uint8_t from, int8_t &i, int8_t &q){
+  CS4toCS8(from, i, q);
+  i = U8toS8(uint8_t(i));
+  q = U8toS8(uint8_t(q));
+}
+inline uint8_t CS8toCU4(int8_t i, int8_t q){
+  return CS8toCS4(int8_t(S8toU8(i)), int8_t(S8toU8(q)));
+}
+
 
 }
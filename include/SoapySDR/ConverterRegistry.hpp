@@ -13,10 +13,12 @@
 #include <SoapySDR/Config.hpp>
 #include <SoapySDR/Logger.hpp>
 #include <SoapySDR/Formats.hpp>
+#include <cstdint>
 #include <utility>
 #include <vector>
 #include <map>
 #include <string>
+#include <memory>
 
 namespace SoapySDR
 {
@@ -41,6 +43,57 @@ namespace SoapySDR
      */
     typedef void (*ConverterFunction)(const void *, void *, const size_t, const double);
 
+    /*!
+     * A typedef for declaring a DeinterleaveFunction to be maintained in the ConverterRegistry.
+     * A deinterleave function splits an interleaved multi-channel input buffer of one format
+     * into one output buffer per channel of another format.
+     * The parameters are (input pointer, output pointers, number of channels, number of elements per channel, optional scalar)
+     */
+    typedef void (*DeinterleaveFunction)(const void *, void * const *, const size_t, const size_t, const double);
+
+    /*!
+     * A typedef for declaring an InterleaveFunction to be maintained in the ConverterRegistry.
+     * An interleave function merges one input buffer per channel of one format
+     * into an interleaved multi-channel output buffer of another format.
+     * The parameters are (input pointers, output pointer, number of channels, number of elements per channel, optional scalar)
+     */
+    typedef void (*InterleaveFunction)(const void * const *, void *, const size_t, const size_t, const double);
+
+    //! The order of the CIC filter applied by a DecimateFunction
+    static const size_t DECIMATE_ORDER = 4;
+
+    //! The largest decimation factor before the integrators of a 16 bit input can overflow
+    static const size_t DECIMATE_MAX_FACTOR = 4096;
+
+    /*!
+     * The filter history of a DecimateFunction.
+     * The state carries the CIC integrators and combs across calls
+     * so that a stream can be decimated one buffer at a time.
+     * Value initialize a state to start the filter at rest: DecimateState state = {};
+     */
+    struct DecimateState
+    {
+      //! the sum of each integrator stage, interleaved I and Q
+      uint64_t integrators[2*DECIMATE_ORDER];
+      //! the delay of each comb stage, interleaved I and Q
+      uint64_t combs[2*DECIMATE_ORDER];
+      //! the number of input elements since the last output element
+      size_t phase;
+    };
+
+    /*!
+     * A typedef for declaring a DecimateFunction to be maintained in the ConverterRegistry.
+     * A decimate function converts a complex input buffer of one format into an output buffer
+     * of another format while decimating by an integer factor in the same pass.
+     * The filter is a CIC filter of order DECIMATE_ORDER with unity gain at DC;
+     * its passband droop should be corrected by a later stage when it matters.
+     * Each factor input elements produce one output element, and the state
+     * carries the remainder of a partial block into the next call.
+     * The parameters are (input pointer, output pointer, number of input elements,
+     * decimation factor, filter state, optional scalar) and the result is the number of output elements.
+     */
+    typedef size_t (*DecimateFunction)(const void *, void *, const size_t, const size_t, DecimateState &, const double);
+
     /*!
      * FunctionPriority: allow selection of a converter function with a given source and target format.
      */
@@ -79,6 +132,74 @@ namespace SoapySDR
      * \param converter function to register
      */
     ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converter);
+
+    /*!
+     * Class constructor. Registers a ConverterFunction with a
+     * given source format, target format, priority, and the
+     * name of the instruction set used by the implementation.
+     *
+     * refuses to register converter and logs error if a source/target/priority entry already exists
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter to register
+     * \param converter function to register
+     * \param instructionSet the instruction set name, example "avx2"
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converter, const std::string &instructionSet);
+
+    /*!
+     * Class constructor. Registers a ConverterFunction with a
+     * given source format, target format, priority, instruction set,
+     * and whether the function may convert a buffer in-place.
+     *
+     * An in-place function produces the same output when the source
+     * and target buffers are the same pointer, see isInPlace().
+     *
+     * refuses to register converter and logs error if a source/target/priority entry already exists
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter to register
+     * \param converter function to register
+     * \param instructionSet the instruction set name, example "avx2", or empty when unspecified
+     * \param inPlace true when the function accepts srcBuff == dstBuff
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converter, const std::string &instructionSet, const bool inPlace);
+
+    /*!
+     * Class constructor. Registers a DeinterleaveFunction with a
+     * given source format, target format, and priority.
+     *
+     * refuses to register converter and logs error if a source/target/priority entry already exists
+     * \param sourceFormat the source format markup string of the interleaved input
+     * \param targetFormat the target format markup string of each channel output
+     * \param priority the FunctionPriority of the converter to register
+     * \param deinterleaver function to register
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, DeinterleaveFunction deinterleaver);
+
+    /*!
+     * Class constructor. Registers an InterleaveFunction with a
+     * given source format, target format, and priority.
+     *
+     * refuses to register converter and logs error if a source/target/priority entry already exists
+     * \param sourceFormat the source format markup string of each channel input
+     * \param targetFormat the target format markup string of the interleaved output
+     * \param priority the FunctionPriority of the converter to register
+     * \param interleaver function to register
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, InterleaveFunction interleaver);
+
+    /*!
+     * Class constructor. Registers a DecimateFunction with a
+     * given source format, target format, and priority.
+     *
+     * refuses to register converter and logs error if a source/target/priority entry already exists
+     * \param sourceFormat the source format markup string of the full rate input
+     * \param targetFormat the target format markup string of the decimated output
+     * \param priority the FunctionPriority of the converter to register
+     * \param decimator function to register
+     */
+    ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, DecimateFunction decimator);
     
     /*!
      * Get a list of existing target formats to which we can convert the specified source from.
@@ -107,7 +228,34 @@ namespace SoapySDR
     static std::vector<FunctionPriority> listPriorities(const std::string &sourceFormat, const std::string &targetFormat);
     
     /*!
-     * Get a converter between a source and target format with the highest available priority.
+     * Get the instruction set used by the converter for a given source, target format, and priority.
+     * This reports which SIMD implementation was selected for the host processor at load time.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter
+     * \return the instruction set name, example "avx2", or empty when unspecified at registration
+     */
+    static std::string getInstructionSet(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * Can the converter for a given source, target format, and priority convert in-place?
+     * An in-place converter accepts the same pointer for the source and target buffers,
+     * which lets same-width and narrowing conversions reuse a single buffer.
+     * Partially overlapping buffers are never supported.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter
+     * \return true when the function was registered as in-place
+     */
+    static bool isInPlace(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * Get a converter between a source and target format with the highest available priority,
+     * or with the priority selected by tuning, see getSelectedPriority().
+     * The first lookup of any converter in a process reads the wisdom file
+     * at getWisdomPath() when it exists, see loadWisdom().
      * \throws invalid_argument when the conversion does not exist and logs error
      * \param sourceFormat the source format markup string
      * \param targetFormat the target format markup string
@@ -126,6 +274,405 @@ namespace SoapySDR
      */
     static std::vector<std::string> listAvailableSourceFormats(void);
 
+    /*!
+     * Get a deinterleaver between a source and target format with the highest available priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string of the interleaved input
+     * \param targetFormat the target format markup string of each channel output
+     * \return a deinterleave function pointer
+     */
+    static DeinterleaveFunction getDeinterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a deinterleaver between a source and target format with a given priority.
+     * \throws runtime_error when the conversion does not exist
+     */
+    static DeinterleaveFunction getDeinterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * Get an interleaver between a source and target format with the highest available priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string of each channel input
+     * \param targetFormat the target format markup string of the interleaved output
+     * \return an interleave function pointer
+     */
+    static InterleaveFunction getInterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get an interleaver between a source and target format with a given priority.
+     * \throws runtime_error when the conversion does not exist
+     */
+    static InterleaveFunction getInterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * Get a decimator between a source and target format with the highest available priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string of the full rate input
+     * \param targetFormat the target format markup string of the decimated output
+     * \return a decimate function pointer
+     */
+    static DecimateFunction getDecimateFunction(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Get a decimator between a source and target format with a given priority.
+     * \throws runtime_error when the conversion does not exist
+     */
+    static DecimateFunction getDecimateFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority);
+
+    /*!
+     * Convert multiple channels with a single call.
+     * The buffer arrays follow the readStream()/writeStream() convention,
+     * one pointer per channel, and every channel converts numElems elements.
+     * \param converter the conversion function to apply to each channel
+     * \param srcBuffs an array of input buffers in the source format
+     * \param dstBuffs an array of output buffers in the target format
+     * \param numChans the number of channels in each buffer array
+     * \param numElems the number of elements to convert per channel
+     * \param scaler the scale factor passed to the converter
+     */
+    static void convertChannels(ConverterFunction converter, const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler);
+
+    /*!
+     * Get the priority selected by getFunction() for a source and target format.
+     * This is the highest registered priority, unless tuning found a faster
+     * converter on this host, see tune() and loadWisdom().
+     *
+     * When the SOAPY_SDR_CONVERTER_TUNE environment variable is set to 1,
+     * conversions without tuning results are tuned on first use,
+     * and the results are saved to the wisdom file at getWisdomPath().
+     * Conversions with a format of unknown size are never tuned.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return the selected priority
+     */
+    static FunctionPriority getSelectedPriority(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Time every registered priority of a conversion on this host,
+     * and select the fastest for subsequent getFunction() calls.
+     * \throws runtime_error when the conversion does not exist
+     * \throws runtime_error when formatToSize() of either format is 0
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return the priority of the fastest converter
+     */
+    static FunctionPriority tune(const std::string &sourceFormat, const std::string &targetFormat);
+
+    /*!
+     * Tune every registered conversion with more than one priority.
+     * Conversions with a format of unknown size are skipped.
+     * Call saveWisdom() afterwards to keep the results for later processes.
+     */
+    static void tune(void);
+
+    /*!
+     * Get the path of the wisdom file which holds the tuning results for this host.
+     * The SOAPY_SDR_CONVERTER_WISDOM environment variable overrides the path,
+     * otherwise the file is named after the host in the user's cache directory.
+     * \return the file path or empty when no cache directory is known
+     */
+    static std::string getWisdomPath(void);
+
+    /*!
+     * Load tuning results from a wisdom file.
+     * The first lookup of any converter in a process, such as getFunction(),
+     * implicitly loads the wisdom file at getWisdomPath() when it exists;
+     * the SOAPY_SDR_CONVERTER_WISDOM environment variable selects another file.
+     * Entries for a priority that is not registered for their conversion
+     * are dropped with a warning, so converters registered after the
+     * first lookup need this call again to use their results.
+     * Results are ignored for conversions whose registered priorities
+     * or instruction sets have changed since they were tuned.
+     * \param path the path of the wisdom file
+     * \return true when the file was read
+     */
+    static bool loadWisdom(const std::string &path);
+
+    /*!
+     * Save the tuning results to a wisdom file.
+     * Missing parent directories are created.
+     * \param path the path of the wisdom file
+     * \return true when the file was written
+     */
+    static bool saveWisdom(const std::string &path);
+
+    /*!
+     * Find the cheapest chain of registered conversions from a source to a target format.
+     * The cost of a chain is the number of bytes each element moves through every conversion.
+     * Intermediate formats are never less precise than both the source and target formats.
+     * A direct conversion, when registered, is always a chain of one conversion.
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \return the formats along the chain, including the source and target formats,
+     * or an empty vector when no chain exists
+     */
+    static std::vector<std::string> findPath(const std::string &sourceFormat, const std::string &targetFormat);
+
+  };
+
+  /*!
+   * PreparedConverter class. A PreparedConverter resolves a ConverterFunction
+   * from the ConverterRegistry once, along with the element sizes and scaler,
+   * so that streaming code can convert buffers without repeated registry lookups.
+   * Create one when a stream is setup and call convert() in the streaming loop.
+   *
+   * When no direct conversion is registered, the converter chains registered
+   * conversions through intermediate formats, see ConverterRegistry::findPath().
+   * The chain converts in cache-sized blocks through per-thread scratch buffers.
+   * The scaler is applied by the first conversion with a floating point output,
+   * or by the first conversion when the chain is integer only.
+   *
+   * convert() also accepts the same buffer for the source and target.
+   * Functions that were not registered as in-place convert through
+   * the per-thread scratch buffers one block at a time, see isInPlace().
+   */
+  class SOAPY_SDR_API PreparedConverter
+  {
+  public:
+
+    //! Create an empty converter that cannot be used until assigned
+    PreparedConverter(void);
+
+    /*!
+     * Prepare a converter with the priority selected by getSelectedPriority(),
+     * or a chain of conversions when no direct conversion is registered.
+     * \throws runtime_error when neither the conversion nor a chain exists
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param scaler the scale factor applied by every conversion
+     */
+    PreparedConverter(const std::string &sourceFormat, const std::string &targetFormat, const double scaler = 1.0);
+
+    /*!
+     * Prepare a converter with a given priority.
+     * \throws runtime_error when the conversion does not exist
+     * \param sourceFormat the source format markup string
+     * \param targetFormat the target format markup string
+     * \param priority the FunctionPriority of the converter
+     * \param scaler the scale factor applied by every conversion
+     */
+    PreparedConverter(const std::string &sourceFormat, const std::string &targetFormat, const ConverterRegistry::FunctionPriority &priority, const double scaler = 1.0);
+
+    //! Is this converter prepared with a function?
+    explicit operator bool(void) const;
+
+    //! Get the source format markup string
+    const std::string &getSourceFormat(void) const;
+
+    //! Get the target format markup string
+    const std::string &getTargetFormat(void) const;
+
+    //! Get the priority of the resolved function, or the lowest priority in a chain
+    ConverterRegistry::FunctionPriority getPriority(void) const;
+
+    //! Get the instruction set of the resolved function, example "avx2", or a comma separated list for a chain
+    const std::string &getInstructionSet(void) const;
+
+    //! Does convert() accept srcBuff == dstBuff without staging through scratch buffers?
+    bool isInPlace(void) const;
+
+    //! Get the formats along the conversion, including the source and target formats
+    std::vector<std::string> getPath(void) const;
+
+    //! Get the size in bytes of one source element
+    size_t getSourceElemSize(void) const;
+
+    //! Get the size in bytes of one target element
+    size_t getTargetElemSize(void) const;
+
+    //! Get the scale factor applied by convert()
+    double getScaler(void) const;
+
+    //! Get the resolved conversion function, or nullptr for a chain of conversions
+    ConverterRegistry::ConverterFunction getFunction(void) const;
+
+    /*!
+     * Convert a buffer using the resolved function and scaler.
+     * The source and target may be the same buffer, but must not partially overlap.
+     * \throws runtime_error for the same buffer when the function is not in-place
+     * and formatToSize() of either format is 0, since the buffer cannot be staged
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format
+     * \param numElems the number of elements to convert
+     */
+    void convert(const void *srcBuff, void *dstBuff, const size_t numElems) const;
+
+    /*!
+     * Convert multiple channels using the resolved function and scaler.
+     * \param srcBuffs an array of input buffers in the source format
+     * \param dstBuffs an array of output buffers in the target format
+     * \param numChans the number of channels in each buffer array
+     * \param numElems the number of elements to convert per channel
+     */
+    void convert(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems) const;
+
+  private:
+    struct Path;
+    void convertPath(const void *srcBuff, void *dstBuff, const size_t numElems) const;
+    void convertInPlace(void *buff, const size_t numElems) const;
+
+    ConverterRegistry::ConverterFunction _function;
+    double _scaler;
+    size_t _sourceElemSize, _targetElemSize;
+    ConverterRegistry::FunctionPriority _priority;
+    std::string _sourceFormat, _targetFormat, _instructionSet;
+    bool _inPlace;
+    std::shared_ptr<const Path> _path;
+  };
+
+  /*!
+   * PreparedDecimator class. A PreparedDecimator resolves a DecimateFunction
+   * from the ConverterRegistry once and owns its filter state, so that streaming
+   * code can convert and decimate consecutive buffers in a single pass.
+   * Create one when a stream is setup and call decimate() in the streaming loop.
+   */
+  class SOAPY_SDR_API PreparedDecimator
+  {
+  public:
+
+    //! Create an empty decimator that cannot be used until assigned
+    PreparedDecimator(void);
+
+    /*!
+     * Prepare a decimator with the highest available priority.
+     * \throws runtime_error when the conversion does not exist
+     * \throws invalid_argument when the factor is zero or above DECIMATE_MAX_FACTOR
+     * \param sourceFormat the source format markup string of the full rate input
+     * \param targetFormat the target format markup string of the decimated output
+     * \param factor the integer decimation factor
+     * \param scaler the scale factor applied to the output
+     */
+    PreparedDecimator(const std::string &sourceFormat, const std::string &targetFormat, const size_t factor, const double scaler = 1.0);
+
+    //! Is this decimator prepared with a function?
+    explicit operator bool(void) const;
+
+    //! Get the decimation factor
+    size_t getFactor(void) const;
+
+    //! Get the size in bytes of one source element
+    size_t getSourceElemSize(void) const;
+
+    //! Get the size in bytes of one target element
+    size_t getTargetElemSize(void) const;
+
+    //! Get the number of output elements the next decimate() call produces from numElems input elements
+    size_t getNumOutputElems(const size_t numElems) const;
+
+    /*!
+     * Convert and decimate the next buffer of the stream.
+     * \param srcBuff the input buffer in the source format
+     * \param dstBuff the output buffer in the target format, see getNumOutputElems()
+     * \param numElems the number of input elements
+     * \return the number of output elements written
+     */
+    size_t decimate(const void *srcBuff, void *dstBuff, const size_t numElems);
+
+    //! Clear the filter history, for example after a discontinuity in the stream
+    void reset(void);
+
+  private:
+    ConverterRegistry::DecimateFunction _function;
+    size_t _factor;
+    double _scaler;
+    size_t _sourceElemSize, _targetElemSize;
+    ConverterRegistry::DecimateState _state;
   };
-  
+
+}
+
+inline SoapySDR::PreparedConverter::operator bool(void) const
+{
+  return _function != nullptr or _path;
+}
+
+inline const std::string &SoapySDR::PreparedConverter::getSourceFormat(void) const
+{
+  return _sourceFormat;
+}
+
+inline const std::string &SoapySDR::PreparedConverter::getTargetFormat(void) const
+{
+  return _targetFormat;
+}
+
+inline SoapySDR::ConverterRegistry::FunctionPriority SoapySDR::PreparedConverter::getPriority(void) const
+{
+  return _priority;
+}
+
+inline const std::string &SoapySDR::PreparedConverter::getInstructionSet(void) const
+{
+  return _instructionSet;
+}
+
+inline bool SoapySDR::PreparedConverter::isInPlace(void) const
+{
+  return _inPlace;
+}
+
+inline size_t SoapySDR::PreparedConverter::getSourceElemSize(void) const
+{
+  return _sourceElemSize;
+}
+
+inline size_t SoapySDR::PreparedConverter::getTargetElemSize(void) const
+{
+  return _targetElemSize;
+}
+
+inline double SoapySDR::PreparedConverter::getScaler(void) const
+{
+  return _scaler;
+}
+
+inline SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::PreparedConverter::getFunction(void) const
+{
+  return _function;
+}
+
+inline void SoapySDR::PreparedConverter::convert(const void *srcBuff, void *dstBuff, const size_t numElems) const
+{
+  if (_path) this->convertPath(srcBuff, dstBuff, numElems);
+  else if (srcBuff == dstBuff and not _inPlace) this->convertInPlace(dstBuff, numElems);
+  else _function(srcBuff, dstBuff, numElems, _scaler);
+}
+
+inline void SoapySDR::PreparedConverter::convert(const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems) const
+{
+  bool staged(_path != nullptr);
+  if (not _inPlace) for (size_t i = 0; i < numChans; i++) if (srcBuffs[i] == dstBuffs[i]) staged = true;
+  if (staged) for (size_t i = 0; i < numChans; i++) this->convert(srcBuffs[i], dstBuffs[i], numElems);
+  else ConverterRegistry::convertChannels(_function, srcBuffs, dstBuffs, numChans, numElems, _scaler);
+}
+
+inline SoapySDR::PreparedDecimator::operator bool(void) const
+{
+  return _function != nullptr;
+}
+
+inline size_t SoapySDR::PreparedDecimator::getFactor(void) const
+{
+  return _factor;
+}
+
+inline size_t SoapySDR::PreparedDecimator::getSourceElemSize(void) const
+{
+  return _sourceElemSize;
+}
+
+inline size_t SoapySDR::PreparedDecimator::getTargetElemSize(void) const
+{
+  return _targetElemSize;
+}
+
+inline size_t SoapySDR::PreparedDecimator::getNumOutputElems(const size_t numElems) const
+{
+  return (_state.phase + numElems)/_factor;
+}
+
+inline size_t SoapySDR::PreparedDecimator::decimate(const void *srcBuff, void *dstBuff, const size_t numElems)
+{
+  return _function(srcBuff, dstBuff, numElems, _factor, _state, _scaler);
 }
@@ -67,6 +67,25 @@ SOAPY_SDR_API char **SoapySDRConverter_listSourceFormats(const char *targetForma
  */
 SOAPY_SDR_API SoapySDRConverterFunctionPriority *SoapySDRConverter_listPriorities(const char *sourceFormat, const char *targetFormat, size_t *length);
 
+/*!
+ * Get the instruction set used by the converter for a given source, target format, and priority.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param priority the converter priority
+ * \return the instruction set name (caller must free) or nullptr if none are found
+ */
+SOAPY_SDR_API char *SoapySDRConverter_getInstructionSet(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority);
+
+/*!
+ * Can the converter for a given source, target format, and priority convert in-place?
+ * An in-place converter accepts the same pointer for the input and output buffers.
+ * \param sourceFormat the source format markup string
+ * \param targetFormat the target format markup string
+ * \param priority the converter priority
+ * \return true when the converter was registered as in-place, false otherwise or if none are found
+ */
+SOAPY_SDR_API bool SoapySDRConverter_isInPlace(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority);
+
 /*!
  * Get a converter between a source and target format with the highest available priority.
  * \param sourceFormat the source format markup string
@@ -83,6 +102,20 @@ SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getFunction(const char
  */
 SOAPY_SDR_API SoapySDRConverterFunction SoapySDRConverter_getFunctionWithPriority(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority);
 
+/*!
+ * Convert multiple channels with a single call.
+ * The buffer arrays follow the readStream()/writeStream() convention,
+ * one pointer per channel, and every channel converts numElems elements.
+ * \param converter the conversion function to apply to each channel
+ * \param srcBuffs an array of input buffers in the source format
+ * \param dstBuffs an array of output buffers in the target format
+ * \param numChans the number of channels in each buffer array
+ * \param numElems the number of elements to convert per channel
+ * \param scaler the scale factor passed to the converter
+ * \return 0 for success or error code on failure
+ */
+SOAPY_SDR_API int SoapySDRConverter_convertChannels(const SoapySDRConverterFunction converter, const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler);
+
 /*!
  * Get a list of known source formats in the registry.
  * \param [out] length the number of known source formats
@@ -0,0 +1,119 @@
+///
+/// \file SoapySDR/ConvertingStream.hpp
+///
+/// Stream in any registered format, converting from the native format in software.
+///
+/// \copyright
+/// Copyright (c) 2026 SoapySDR contributors
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Buffers.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace SoapySDR
+{
+/*!
+ * ConvertingStream class. A ConvertingStream sets up a stream in any format
+ * that the ConverterRegistry can reach from the native format of the device.
+ * When the device lists the requested format in getStreamFormats(), the stream
+ * is opened in that format and read() and write() pass straight through.
+ * Otherwise the stream is opened in the native format and read() and write()
+ * convert with a PreparedConverter, scaled so that the native full scale
+ * maps to the full scale of the requested format.
+ *
+ * When the stream provides direct access buffers, read() converts straight out
+ * of acquired buffers and write() straight into them, so the conversion is the
+ * only copy. Otherwise the native samples are staged in one MTU of memory.
+ *
+ * The device is used but not owned; the stream is closed with the ConvertingStream.
+ */
+class SOAPY_SDR_API ConvertingStream
+{
+public:
+
+    /*!
+     * Setup a stream in the requested format.
+     * The arguments are the same as for Device::setupStream().
+     * \throws runtime_error when no conversion from the native format exists
+     * \throws runtime_error when the device fails to setup the stream
+     * \param device a pointer to a device instance
+     * \param direction the channel direction (SOAPY_SDR_RX or SOAPY_SDR_TX)
+     * \param format the format of the buffers passed to read() and write()
+     * \param channels a list of channels or empty for automatic
+     * \param args stream args or empty for defaults
+     */
+    ConvertingStream(
+        Device *device,
+        const int direction,
+        const std::string &format,
+        const std::vector<size_t> &channels = std::vector<size_t>(),
+        const Kwargs &args = Kwargs());
+
+    //! Close the stream
+    ~ConvertingStream(void);
+
+    ConvertingStream(const ConvertingStream &) = delete;
+    ConvertingStream &operator=(const ConvertingStream &) = delete;
+
+    //! Get the device stream for calls like activateStream() and readStreamStatus()
+    Stream *getStream(void) const;
+
+    //! Get the format of the buffers passed to read() and write()
+    const std::string &getFormat(void) const;
+
+    //! Get the format the device stream was setup with
+    const std::string &getStreamFormat(void) const;
+
+    //! Does read() or write() convert between the two formats?
+    bool isConverting(void) const;
+
+    //! Get the maximum number of elements per read() or write() call that avoids fragmentation
+    size_t getMTU(void) const;
+
+    /*!
+     * Read and convert elements from a receive stream.
+     * When a read consumes only part of an acquired direct access buffer,
+     * SOAPY_SDR_MORE_FRAGMENTS is set and the next read returns the
+     * remainder without SOAPY_SDR_HAS_TIME.
+     * The arguments and return value are the same as for Device::readStream().
+     */
+    int read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs = 100000);
+
+    /*!
+     * Convert and write elements to a transmit stream.
+     * The arguments and return value are the same as for Device::writeStream().
+     */
+    int write(const void * const *buffs, const size_t numElems, int &flags, const long long timeNs = 0, const long timeoutUs = 100000);
+
+private:
+    int readDirect(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs);
+    int writeDirect(const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs);
+
+    Device *_device;
+    Stream *_stream;
+    std::string _format, _streamFormat;
+    size_t _numChans, _mtu;
+    PreparedConverter _converter;
+    bool _direct;
+
+    //native buffers when the stream has no direct access buffers
+    BufferPool _scratch;
+
+    //the acquired receive buffer that was not completely read
+    std::vector<const void *> _readBuffs, _readSrcs;
+    size_t _readHandle, _readOffset, _readElems;
+    int _readFlags;
+    long long _readTimeNs;
+
+    //the acquired transmit buffer
+    std::vector<void *> _writeBuffs;
+};
+
+}
@@ -341,6 +341,11 @@ public:
      * When inactive, readStream() should implement the timeout
      * specified by the caller and return SOAPY_SDR_TIMEOUT.
      *
+     * **Default implementation:**
+     * For a stream enabled with setupDefaultStream(), elements are copied
+     * out of acquireReadBuffer(), and an acquired buffer that does not fit
+     * is returned over several calls with SOAPY_SDR_MORE_FRAGMENTS.
+     *
      * \param stream the opaque pointer to a stream handle
      * \param buffs an array of void* buffers num chans in size
      * \param numElems the number of elements in each buffer
@@ -368,6 +373,10 @@ public:
      * such that the call blocks until space becomes available
      * or timeout expiration.
      *
+     * **Default implementation:**
+     * For a stream enabled with setupDefaultStream(), elements are copied
+     * into acquireWriteBuffer() and sent with releaseWriteBuffer().
+     *
      * \param stream the opaque pointer to a stream handle
      * \param buffs an array of void* buffers num chans in size
      * \param numElems the number of elements in each buffer
@@ -420,6 +429,8 @@ public:
      * This is the number of times the user can call acquire()
      * on a stream without making subsequent calls to release().
      * A return value of 0 means that direct access is not supported.
+     * The default acquire and release calls of setupDefaultStream()
+     * copy through internal buffers and do not count as direct access.
      *
      * \param stream the opaque pointer to a stream handle
      * \return the number of direct access buffers or 0
@@ -453,6 +464,10 @@ public:
      * Handle represents an index into the internal scatter/gather table
      * such that handle is between 0 and num direct buffers - 1.
      *
+     * **Default implementation:**
+     * For a stream enabled with setupDefaultStream(), one MTU is read
+     * with readStream() into an internal buffer of the device.
+     *
      * \param stream the opaque pointer to a stream handle
      * \param handle an index value used in the release() call
      * \param buffs an array of void* buffers num chans in size
@@ -492,6 +507,10 @@ public:
      * Handle represents an index into the internal scatter/gather table
      * such that handle is between 0 and num direct buffers - 1.
      *
+     * **Default implementation:**
+     * For a stream enabled with setupDefaultStream(), an internal buffer
+     * of one MTU is provided and releaseWriteBuffer() sends it with writeStream().
+     *
      * \param stream the opaque pointer to a stream handle
      * \param handle an index value used in the release() call
      * \param buffs an array of void* buffers num chans in size
@@ -1448,6 +1467,34 @@ public:
      * \return a handle to the native device or null
      */
     virtual void* getNativeDeviceHandle(void) const;
+
+protected:
+
+    /*******************************************************************
+     * Default stream support
+     ******************************************************************/
+
+    /*!
+     * Enable the default stream implementations for a stream.
+     * The default readStream() and writeStream() copy through the direct
+     * buffer access API, and the default acquire and release calls stage
+     * through internal buffers with readStream() and writeStream().
+     * An implementation may provide either API and get the other one
+     * by calling this from setupStream(), since only setupStream()
+     * knows the size of the elements and the number of channels.
+     * When neither API is implemented, both return SOAPY_SDR_NOT_SUPPORTED.
+     * \param stream the opaque pointer to a stream handle
+     * \param format the format the stream was setup with
+     * \param numChans the number of channels in the stream
+     */
+    void setupDefaultStream(Stream *stream, const std::string &format, const size_t numChans);
+
+    /*!
+     * Free the state of the default stream implementations.
+     * Call from closeStream() for a stream that called setupDefaultStream().
+     * \param stream the opaque pointer to a stream handle
+     */
+    void closeDefaultStream(Stream *stream);
 };
 
 }
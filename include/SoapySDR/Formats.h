@@ -21,12 +21,18 @@
 //! Complex signed 32-bit integers (complex int32)
 #define SOAPY_SDR_CS32 "CS32"
 
+//! Complex signed 32-bit integers, big endian (network byte order)
+#define SOAPY_SDR_CS32BE "CS32BE"
+
 //! Complex unsigned 32-bit integers (complex uint32)
 #define SOAPY_SDR_CU32 "CU32"
 
 //! Complex signed 16-bit integers (complex int16)
 #define SOAPY_SDR_CS16 "CS16"
 
+//! Complex signed 16-bit integers, big endian (network byte order)
+#define SOAPY_SDR_CS16BE "CS16BE"
+
 //! Complex unsigned 16-bit integers (complex uint16)
 #define SOAPY_SDR_CU16 "CU16"
 
@@ -54,6 +60,15 @@
 //! Real 32-bit floats (float)
 #define SOAPY_SDR_F32 "F32"
 
+//! Real 32-bit floats, power of complex samples (|x|^2)
+#define SOAPY_SDR_F32POW "F32POW"
+
+//! Real 32-bit floats, magnitude of complex samples (|x|)
+#define SOAPY_SDR_F32MAG "F32MAG"
+
+//! Real 32-bit floats, power of complex samples in dB (10*log10(|x|^2), approximate)
+#define SOAPY_SDR_F32DB "F32DB"
+
 //! Real signed 32-bit integers (int32)
 #define SOAPY_SDR_S32 "S32"
 
@@ -0,0 +1,121 @@
+///
+/// \file SoapySDR/MultiDeviceRxStream.hpp
+///
+/// Receive from several synchronized devices as one time-aligned stream.
+///
+/// \copyright
+/// Copyright (c) 2026 SoapySDR contributors
+/// SPDX-License-Identifier: BSL-1.0
+///
+
+#pragma once
+#include <SoapySDR/Config.hpp>
+#include <SoapySDR/Device.hpp>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace SoapySDR
+{
+/*!
+ * MultiDeviceRxStream class. A MultiDeviceRxStream reads the receive streams
+ * of N devices with M channels each, and presents them as one stream of N*M
+ * channels: channel j of device i is channel i*M+j of the aggregate stream.
+ *
+ * Each device is read on its own thread by a BufferedRxStream, and read()
+ * aligns the samples on their time stamps, so every element of a read has the
+ * same time on all channels. The device times must be synchronized beforehand,
+ * for example with setHardwareTime() on a common PPS edge, and every stream must
+ * report SOAPY_SDR_HAS_TIME; elements without a known time are discarded.
+ *
+ * Elements that precede the latest stream are discarded, so the aggregate
+ * stream starts once every device has data. When any device drops elements,
+ * read() reports the gap with SOAPY_SDR_OVERFLOW and resumes at the time
+ * from which all devices have data again.
+ *
+ * The devices and streams are used but not owned, and the streams
+ * must not be read by the application while the aggregate is active.
+ */
+class SOAPY_SDR_API MultiDeviceRxStream
+{
+public:
+
+    /*!
+     * Create an aggregate of open receive streams.
+     * \throws invalid_argument when the device and stream lists differ in size or are empty
+     * \throws invalid_argument when the sample rate is not positive
+     * \throws invalid_argument when the format size is unknown
+     * \throws runtime_error when the ring allocation fails
+     * \param devices a list of device instances
+     * \param streams the receive stream of each device
+     * \param format the format every stream was setup with, example "CS16"
+     * \param numChans the number of channels every stream was setup with
+     * \param sampleRate the common sample rate of the streams in samples per second
+     * \param numChunks the depth of each device ring in stream MTUs
+     * \param bufferFlags optional SOAPY_SDR_BUFFER_* flags for the ring memory
+     */
+    MultiDeviceRxStream(
+        const std::vector<Device *> &devices,
+        const std::vector<Stream *> &streams,
+        const std::string &format,
+        const size_t numChans,
+        const double sampleRate,
+        const size_t numChunks = 256,
+        const int bufferFlags = 0);
+
+    //! Deactivate the streams when active and free the rings
+    ~MultiDeviceRxStream(void);
+
+    MultiDeviceRxStream(const MultiDeviceRxStream &) = delete;
+    MultiDeviceRxStream &operator=(const MultiDeviceRxStream &) = delete;
+
+    /*!
+     * Activate every stream and start the reader threads.
+     * The arguments are passed to Device::activateStream(),
+     * so use SOAPY_SDR_HAS_TIME for a common start time.
+     * When a stream fails to activate, the others are deactivated.
+     * \return 0 for success or the error code from activateStream()
+     */
+    int activate(const int flags = 0, const long long timeNs = 0, const size_t numElems = 0);
+
+    /*!
+     * Stop the reader threads and deactivate every stream.
+     * The arguments are passed to Device::deactivateStream().
+     * \return 0 for success or the first error code from deactivateStream()
+     */
+    int deactivate(const int flags = 0, const long long timeNs = 0);
+
+    //! Get the number of channels of the aggregate stream
+    size_t getNumChannels(void) const;
+
+    //! Get the largest number of elements that one read() may return
+    size_t getMTU(void) const;
+
+    /*!
+     * Read time-aligned elements from every device.
+     * Each successful read sets SOAPY_SDR_HAS_TIME with the time of the first element.
+     * After a gap, SOAPY_SDR_OVERFLOW is returned with SOAPY_SDR_HAS_TIME
+     * and the time of the first missing element, and the next read
+     * returns the elements from the time where the streams resume.
+     * \param buffs an array of void* buffers getNumChannels() in size
+     * \param numElems the number of elements in each buffer
+     * \param flags optional flag indicators about the result
+     * \param timeNs the buffer's timestamp in nanoseconds
+     * \param timeoutUs the timeout in microseconds
+     * \return the number of elements read per buffer,
+     * SOAPY_SDR_OVERFLOW for a gap before the next elements,
+     * SOAPY_SDR_TIMEOUT when any device has no data,
+     * or the error that stopped a reader thread
+     */
+    int read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs = 100000);
+
+    //! Get the number of gaps reported by read()
+    size_t getNumGaps(void) const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> _impl;
+};
+
+}
@@ -0,0 +1,596 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "SampleRing.hpp"
+#include <SoapySDR/BufferedStreams.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <algorithm> //min
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstring> //memcpy
+#include <deque>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+//the reader thread checks for deactivation at this interval
+static const long THREAD_TIMEOUT_US = 100000;
+
+/***********************************************************************
+ * BufferedRxStream implementation
+ **********************************************************************/
+struct SoapySDR::BufferedRxStream::Impl
+{
+    Impl(Device *device, Stream *stream, const size_t elemSize, const size_t numChans, const size_t numChunks, const int bufferFlags):
+        device(device),
+        stream(stream),
+        elemSize(elemSize),
+        numChans(numChans),
+        mtu(device->getStreamMTU(stream)),
+        ring(numChunks, numChans, mtu*elemSize, bufferFlags),
+        scratch(numChans, mtu*elemSize, bufferFlags),
+        running(false),
+        error(0),
+        numOverflows(0),
+        overflowPending(false),
+        offset(0),
+        readBuffs(numChans)
+    {
+        return;
+    }
+
+    void readerLoop(void);
+    SampleRing::Chunk *claim(void);
+    void drop(void);
+    void publish(const void * const *buffs, const size_t numElems, const int flags, const long long timeNs);
+
+    Device *device;
+    Stream *stream;
+    const size_t elemSize;
+    const size_t numChans;
+    const size_t mtu;
+    SampleRing ring;
+
+    //the reader thread drains the device into scratch when the ring is full
+    BufferPool scratch;
+
+    std::thread thread;
+    std::atomic<bool> running;
+    std::atomic<int> error;
+    std::atomic<size_t> numOverflows;
+
+    //reader thread state: a gap waits here until there is room for its marker
+    bool overflowPending;
+
+    //consumer state: the elements of the front chunk already read
+    size_t offset;
+    std::vector<const void *> readBuffs;
+};
+
+SampleRing::Chunk *SoapySDR::BufferedRxStream::Impl::claim(void)
+{
+    auto chunk = ring.back();
+    if (chunk == nullptr or not overflowPending) return chunk;
+
+    //the gap goes into the ring before any later samples
+    chunk->ret = SOAPY_SDR_OVERFLOW;
+    chunk->numElems = 0;
+    chunk->flags = 0;
+    chunk->timeNs = 0;
+    ring.push();
+    overflowPending = false;
+    return ring.back();
+}
+
+void SoapySDR::BufferedRxStream::Impl::drop(void)
+{
+    //count each gap once, however many reads it spans
+    if (overflowPending) return;
+    overflowPending = true;
+    numOverflows++;
+}
+
+void SoapySDR::BufferedRxStream::Impl::publish(const void * const *buffs, const size_t numElems, const int flags, const long long timeNs)
+{
+    //a direct access buffer larger than the MTU spans several chunks
+    for (size_t done = 0; done < numElems;)
+    {
+        const size_t n = std::min(mtu, numElems-done);
+        int chunkFlags = flags;
+        if (done != 0) chunkFlags &= ~SOAPY_SDR_HAS_TIME;
+        if (done+n != numElems) chunkFlags &= ~SOAPY_SDR_END_BURST;
+
+        auto chunk = this->claim();
+        if (chunk == nullptr) this->drop();
+        else
+        {
+            for (size_t i = 0; i < numChans; i++)
+            {
+                std::memcpy(chunk->buffs[i], (const char *)buffs[i] + done*elemSize, n*elemSize);
+            }
+            chunk->ret = 0;
+            chunk->numElems = n;
+            chunk->flags = chunkFlags;
+            chunk->timeNs = timeNs;
+            ring.push();
+        }
+        done += n;
+    }
+}
+
+void SoapySDR::BufferedRxStream::Impl::readerLoop(void)
+{
+    const bool direct = device->getNumDirectAccessBuffers(stream) != 0;
+    std::vector<const void *> directBuffs(numChans);
+
+    try
+    {
+        while (running)
+        {
+            int ret(0);
+            int flags(0);
+            long long timeNs(0);
+
+            if (direct)
+            {
+                size_t handle(0);
+                ret = device->acquireReadBuffer(stream, handle, directBuffs.data(), flags, timeNs, THREAD_TIMEOUT_US);
+                if (ret > 0)
+                {
+                    this->publish(directBuffs.data(), size_t(ret), flags, timeNs);
+                    device->releaseReadBuffer(stream, handle);
+                    continue;
+                }
+            }
+            else
+            {
+                //read straight into the ring, or into scratch when there is no room
+                auto chunk = this->claim();
+                void * const *buffs = (chunk == nullptr)?scratch.getBuffers():chunk->buffs;
+                ret = device->readStream(stream, buffs, mtu, flags, timeNs, THREAD_TIMEOUT_US);
+                if (ret > 0)
+                {
+                    if (chunk == nullptr)
+                    {
+                        this->drop();
+                        continue;
+                    }
+                    chunk->ret = 0;
+                    chunk->numElems = size_t(ret);
+                    chunk->flags = flags;
+                    chunk->timeNs = timeNs;
+                    ring.push();
+                    continue;
+                }
+            }
+
+            if (ret == 0 or ret == SOAPY_SDR_TIMEOUT) continue;
+            if (ret == SOAPY_SDR_OVERFLOW)
+            {
+                this->drop();
+                continue;
+            }
+
+            //any other error is left for read() once the ring is empty
+            error = ret;
+            break;
+        }
+    }
+    catch (const std::exception &ex)
+    {
+        SoapySDR::logf(SOAPY_SDR_ERROR, "BufferedRxStream reader thread: %s", ex.what());
+        error = SOAPY_SDR_STREAM_ERROR;
+    }
+
+    running = false;
+    ring.notify();
+}
+
+SoapySDR::BufferedRxStream::BufferedRxStream(
+    Device *device,
+    Stream *stream,
+    const std::string &format,
+    const size_t numChans,
+    const size_t numChunks,
+    const int bufferFlags)
+{
+    const size_t elemSize = SoapySDR::formatToSize(format);
+    if (elemSize == 0) throw std::invalid_argument("BufferedRxStream() unknown format "+format);
+    if (numChans == 0) throw std::invalid_argument("BufferedRxStream() no channels");
+    if (numChunks == 0) throw std::invalid_argument("BufferedRxStream() ring depth is zero");
+    _impl.reset(new Impl(device, stream, elemSize, numChans, numChunks, bufferFlags));
+}
+
+SoapySDR::BufferedRxStream::~BufferedRxStream(void)
+{
+    if (_impl->thread.joinable()) this->deactivate();
+}
+
+int SoapySDR::BufferedRxStream::activate(const int flags, const long long timeNs, const size_t numElems)
+{
+    if (_impl->running) return 0;
+    if (_impl->thread.joinable()) _impl->thread.join();
+    const int ret = _impl->device->activateStream(_impl->stream, flags, timeNs, numElems);
+    if (ret != 0) return ret;
+
+    _impl->error = 0;
+    _impl->running = true;
+    _impl->thread = std::thread(&Impl::readerLoop, _impl.get());
+    return 0;
+}
+
+int SoapySDR::BufferedRxStream::deactivate(const int flags, const long long timeNs)
+{
+    if (_impl->thread.joinable())
+    {
+        _impl->running = false;
+        _impl->thread.join();
+    }
+    return _impl->device->deactivateStream(_impl->stream, flags, timeNs);
+}
+
+size_t SoapySDR::BufferedRxStream::getMTU(void) const
+{
+    return _impl->mtu;
+}
+
+int SoapySDR::BufferedRxStream::read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto &impl = *_impl;
+    auto &srcs = impl.readBuffs;
+    const int ret = this->acquire(srcs.data(), flags, timeNs, timeoutUs);
+    if (ret <= 0) return ret;
+
+    const size_t n = std::min(numElems, size_t(ret));
+    for (size_t i = 0; i < impl.numChans; i++)
+    {
+        std::memcpy(buffs[i], srcs[i], n*impl.elemSize);
+    }
+    if (n != size_t(ret))
+    {
+        flags &= ~SOAPY_SDR_END_BURST;
+        flags |= SOAPY_SDR_MORE_FRAGMENTS;
+    }
+    this->release(n);
+    return int(n);
+}
+
+int SoapySDR::BufferedRxStream::acquire(const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto &impl = *_impl;
+    auto chunk = impl.ring.front();
+    if (chunk == nullptr)
+    {
+        impl.ring.wait(timeoutUs, [&impl](void){return impl.ring.size() != 0 or impl.error != 0;});
+        chunk = impl.ring.front();
+    }
+    if (chunk == nullptr)
+    {
+        const int error = impl.error;
+        return (error == 0)?SOAPY_SDR_TIMEOUT:error;
+    }
+
+    flags = 0;
+    if (chunk->ret != 0)
+    {
+        const int ret = chunk->ret;
+        impl.ring.pop();
+        return ret;
+    }
+
+    for (size_t i = 0; i < impl.numChans; i++)
+    {
+        buffs[i] = (const char *)chunk->buffs[i] + impl.offset*impl.elemSize;
+    }
+    flags = chunk->flags;
+    timeNs = chunk->timeNs;
+    if (impl.offset != 0) flags &= ~SOAPY_SDR_HAS_TIME;
+    return int(chunk->numElems-impl.offset);
+}
+
+void SoapySDR::BufferedRxStream::release(const size_t numElems)
+{
+    auto &impl = *_impl;
+    auto chunk = impl.ring.front();
+    if (chunk == nullptr) return;
+
+    impl.offset += numElems;
+    if (impl.offset < chunk->numElems) return;
+    impl.offset = 0;
+    impl.ring.pop();
+}
+
+size_t SoapySDR::BufferedRxStream::getNumOverflows(void) const
+{
+    return _impl->numOverflows;
+}
+
+/***********************************************************************
+ * BufferedTxStream implementation
+ **********************************************************************/
+//the writer thread keeps at most this many unread status events
+static const size_t MAX_STATUS_EVENTS = 64;
+
+struct SoapySDR::BufferedTxStream::Impl
+{
+    Impl(Device *device, Stream *stream, const size_t elemSize, const size_t numChans, const size_t numChunks, const int bufferFlags):
+        device(device),
+        stream(stream),
+        elemSize(elemSize),
+        numChans(numChans),
+        mtu(device->getStreamMTU(stream)),
+        ring(numChunks, numChans, mtu*elemSize, bufferFlags),
+        running(false),
+        numUnderflows(0),
+        numStarvations(0),
+        writeOffset(0),
+        deviceStatus(true)
+    {
+        return;
+    }
+
+    //! A status report for readStatus()
+    struct Status
+    {
+        int ret;
+        size_t chanMask;
+        int flags;
+        long long timeNs;
+    };
+
+    void writerLoop(void);
+    bool writeChunk(const SampleRing::Chunk &chunk);
+    void postStatus(const int ret, const int flags, const long long timeNs);
+    bool popStatus(Status &status);
+
+    Device *device;
+    Stream *stream;
+    const size_t elemSize;
+    const size_t numChans;
+    const size_t mtu;
+    SampleRing ring;
+
+    std::thread thread;
+    std::atomic<bool> running;
+    std::atomic<size_t> numUnderflows;
+    std::atomic<size_t> numStarvations;
+
+    //writer state: the elements of the front chunk already written,
+    //kept across deactivate() so the rest of the chunk is sent later
+    size_t writeOffset;
+
+    //status events are rare, so a locked queue is sufficient
+    std::mutex statusMutex;
+    std::condition_variable statusCond;
+    std::deque<Status> statusEvents;
+
+    //cleared when the driver does not implement readStreamStatus()
+    std::atomic<bool> deviceStatus;
+};
+
+void SoapySDR::BufferedTxStream::Impl::postStatus(const int ret, const int flags, const long long timeNs)
+{
+    std::lock_guard<std::mutex> lock(statusMutex);
+    if (statusEvents.size() == MAX_STATUS_EVENTS) statusEvents.pop_front();
+    Status status;
+    status.ret = ret;
+    status.chanMask = (numChans >= sizeof(size_t)*8)?~size_t(0):((size_t(1) << numChans)-1);
+    status.flags = flags;
+    status.timeNs = timeNs;
+    statusEvents.push_back(status);
+    statusCond.notify_all();
+}
+
+bool SoapySDR::BufferedTxStream::Impl::popStatus(Status &status)
+{
+    std::lock_guard<std::mutex> lock(statusMutex);
+    if (statusEvents.empty()) return false;
+    status = statusEvents.front();
+    statusEvents.pop_front();
+    return true;
+}
+
+//returns false when stopped before the chunk was written or dropped
+bool SoapySDR::BufferedTxStream::Impl::writeChunk(const SampleRing::Chunk &chunk)
+{
+    //the time only applies to the first element of the chunk
+    std::vector<const void *> buffs(numChans);
+    for (size_t i = 0; i < numChans; i++) buffs[i] = (const char *)chunk.buffs[i] + writeOffset*elemSize;
+    int flags = (writeOffset == 0)?chunk.flags:(chunk.flags & ~SOAPY_SDR_HAS_TIME);
+    while (writeOffset < chunk.numElems)
+    {
+        int writeFlags = flags;
+        const int ret = device->writeStream(stream, buffs.data(), chunk.numElems-writeOffset, writeFlags, chunk.timeNs, THREAD_TIMEOUT_US);
+        if (ret == 0 or ret == SOAPY_SDR_TIMEOUT)
+        {
+            if (running) continue;
+            return false;
+        }
+        if (ret < 0)
+        {
+            //the rest of the chunk is dropped, example a late burst
+            if (ret == SOAPY_SDR_UNDERFLOW) numUnderflows++;
+            this->postStatus(ret, chunk.flags, chunk.timeNs);
+            break;
+        }
+
+        writeOffset += size_t(ret);
+        flags &= ~SOAPY_SDR_HAS_TIME;
+        for (auto &buff : buffs) buff = (const char *)buff + size_t(ret)*elemSize;
+    }
+    writeOffset = 0;
+    return true;
+}
+
+void SoapySDR::BufferedTxStream::Impl::writerLoop(void)
+{
+    //a burst is open from its first chunk until a chunk with SOAPY_SDR_END_BURST
+    bool inBurst(false);
+
+    try
+    {
+        while (running)
+        {
+            auto chunk = ring.front();
+            if (chunk == nullptr)
+            {
+                //the device may still have samples queued, so this is not an underflow
+                if (inBurst) numStarvations++;
+                inBurst = false;
+                ring.wait(THREAD_TIMEOUT_US, [this](void){return ring.size() != 0 or not running;});
+                continue;
+            }
+
+            //pop only once written, so an empty ring means everything was sent
+            if (not this->writeChunk(*chunk)) break;
+            inBurst = (chunk->flags & SOAPY_SDR_END_BURST) == 0;
+            ring.pop();
+        }
+    }
+    catch (const std::exception &ex)
+    {
+        SoapySDR::logf(SOAPY_SDR_ERROR, "BufferedTxStream writer thread: %s", ex.what());
+        this->postStatus(SOAPY_SDR_STREAM_ERROR, 0, 0);
+    }
+
+    running = false;
+    ring.notify();
+}
+
+SoapySDR::BufferedTxStream::BufferedTxStream(
+    Device *device,
+    Stream *stream,
+    const std::string &format,
+    const size_t numChans,
+    const size_t numChunks,
+    const int bufferFlags)
+{
+    const size_t elemSize = SoapySDR::formatToSize(format);
+    if (elemSize == 0) throw std::invalid_argument("BufferedTxStream() unknown format "+format);
+    if (numChans == 0) throw std::invalid_argument("BufferedTxStream() no channels");
+    if (numChunks == 0) throw std::invalid_argument("BufferedTxStream() ring depth is zero");
+    _impl.reset(new Impl(device, stream, elemSize, numChans, numChunks, bufferFlags));
+}
+
+SoapySDR::BufferedTxStream::~BufferedTxStream(void)
+{
+    if (_impl->thread.joinable()) this->deactivate();
+}
+
+int SoapySDR::BufferedTxStream::activate(const int flags, const long long timeNs, const size_t numElems)
+{
+    if (_impl->running) return 0;
+    if (_impl->thread.joinable()) _impl->thread.join();
+    const int ret = _impl->device->activateStream(_impl->stream, flags, timeNs, numElems);
+    if (ret != 0) return ret;
+
+    _impl->running = true;
+    _impl->thread = std::thread(&Impl::writerLoop, _impl.get());
+    return 0;
+}
+
+int SoapySDR::BufferedTxStream::deactivate(const int flags, const long long timeNs)
+{
+    if (_impl->thread.joinable())
+    {
+        _impl->running = false;
+        _impl->ring.notify();
+        _impl->thread.join();
+    }
+    return _impl->device->deactivateStream(_impl->stream, flags, timeNs);
+}
+
+size_t SoapySDR::BufferedTxStream::getMTU(void) const
+{
+    return _impl->mtu;
+}
+
+int SoapySDR::BufferedTxStream::write(const void * const *buffs, const size_t numElems, const int flags, const long long timeNs, const long timeoutUs)
+{
+    auto &impl = *_impl;
+    if (impl.ring.back() == nullptr)
+    {
+        impl.ring.wait(timeoutUs, [&impl](void){return impl.ring.back() != nullptr;});
+    }
+
+    size_t done(0);
+    while (done < numElems)
+    {
+        auto chunk = impl.ring.back();
+        if (chunk == nullptr) break;
+
+        const size_t n = std::min(impl.mtu, numElems-done);
+        for (size_t i = 0; i < impl.numChans; i++)
+        {
+            std::memcpy(chunk->buffs[i], (const char *)buffs[i] + done*impl.elemSize, n*impl.elemSize);
+        }
+        chunk->ret = 0;
+        chunk->numElems = n;
+        chunk->flags = flags;
+        chunk->timeNs = timeNs;
+        if (done != 0) chunk->flags &= ~SOAPY_SDR_HAS_TIME;
+        if (done+n != numElems) chunk->flags &= ~SOAPY_SDR_END_BURST;
+        impl.ring.push();
+        done += n;
+    }
+
+    if (done == 0 and numElems != 0) return SOAPY_SDR_TIMEOUT;
+    return int(done);
+}
+
+int SoapySDR::BufferedTxStream::flush(const long timeoutUs)
+{
+    auto &impl = *_impl;
+    impl.ring.wait(timeoutUs, [&impl](void){return impl.ring.size() == 0 or not impl.running;});
+    return (impl.ring.size() == 0)?0:SOAPY_SDR_TIMEOUT;
+}
+
+int SoapySDR::BufferedTxStream::readStatus(size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto &impl = *_impl;
+    const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+    Impl::Status status;
+    while (true)
+    {
+        if (impl.popStatus(status))
+        {
+            chanMask = status.chanMask;
+            flags = status.flags;
+            timeNs = status.timeNs;
+            return status.ret;
+        }
+
+        const auto remaining = std::chrono::duration_cast<std::chrono::microseconds>(exitTime - std::chrono::steady_clock::now()).count();
+        if (remaining <= 0) return SOAPY_SDR_TIMEOUT;
+
+        //poll the driver in short slices so that writer thread events are not held up
+        if (impl.deviceStatus)
+        {
+            const long sliceUs = long(std::min<long long>(remaining, THREAD_TIMEOUT_US/10));
+            const int ret = impl.device->readStreamStatus(impl.stream, chanMask, flags, timeNs, sliceUs);
+            if (ret == SOAPY_SDR_NOT_SUPPORTED) impl.deviceStatus = false;
+            else if (ret != SOAPY_SDR_TIMEOUT)
+            {
+                if (ret == SOAPY_SDR_UNDERFLOW) impl.numUnderflows++;
+                return ret;
+            }
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(impl.statusMutex);
+        impl.statusCond.wait_until(lock, exitTime, [&impl](void){return not impl.statusEvents.empty();});
+    }
+}
+
+size_t SoapySDR::BufferedTxStream::getNumUnderflows(void) const
+{
+    return _impl->numUnderflows;
+}
+
+size_t SoapySDR::BufferedTxStream::getNumStarvations(void) const
+{
+    return _impl->numStarvations;
+}
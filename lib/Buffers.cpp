@@ -0,0 +1,234 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Buffers.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <stdexcept>
+#include <cstring> //memset
+#include <utility> //move
+#include <fstream>
+#include <sstream>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef __linux__
+#include <sys/syscall.h>
+#endif
+
+/***********************************************************************
+ * Page mapping helpers
+ *
+ * The pool is a single anonymous mapping so that huge pages and
+ * locking apply to all buffers at once, and the page alignment
+ * of the mapping covers SOAPY_SDR_BUFFER_ALIGNMENT.
+ **********************************************************************/
+static size_t roundUp(const size_t size, const size_t multiple)
+{
+    return ((size + multiple - 1)/multiple)*multiple;
+}
+
+#ifdef _WIN32
+
+static void *mapPages(const size_t size, const bool hugePages)
+{
+    const DWORD type = MEM_RESERVE | MEM_COMMIT | (hugePages?MEM_LARGE_PAGES:0);
+    return VirtualAlloc(nullptr, size, type, PAGE_READWRITE);
+}
+
+static void unmapPages(void *mem, const size_t)
+{
+    VirtualFree(mem, 0, MEM_RELEASE);
+}
+
+static size_t getPageSize(const bool hugePages)
+{
+    if (hugePages) return GetLargePageMinimum();
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return info.dwPageSize;
+}
+
+static bool lockPages(void *mem, const size_t size)
+{
+    return VirtualLock(mem, size) != 0;
+}
+
+static bool bindLocal(void *, const size_t)
+{
+    return false;
+}
+
+#else
+
+static void *mapPages(const size_t size, const bool hugePages)
+{
+    int flags = MAP_PRIVATE | MAP_ANONYMOUS;
+#ifdef MAP_HUGETLB
+    if (hugePages) flags |= MAP_HUGETLB;
+#else
+    if (hugePages) return nullptr;
+#endif
+    void *mem = mmap(nullptr, size, PROT_READ | PROT_WRITE, flags, -1, 0);
+    return (mem == MAP_FAILED)?nullptr:mem;
+}
+
+static void unmapPages(void *mem, const size_t size)
+{
+    munmap(mem, size);
+}
+
+//the default huge page size from /proc/meminfo, or 0 when unknown
+static size_t getHugePageSize(void)
+{
+    std::ifstream meminfo("/proc/meminfo");
+    std::string line;
+    while (std::getline(meminfo, line))
+    {
+        std::istringstream ss(line);
+        std::string key;
+        size_t sizeKb(0);
+        if (ss >> key >> sizeKb and key == "Hugepagesize:") return sizeKb*1024;
+    }
+    return 0;
+}
+
+static size_t getPageSize(const bool hugePages)
+{
+    static const size_t hugePageSize = getHugePageSize();
+    if (hugePages) return hugePageSize;
+    return size_t(sysconf(_SC_PAGESIZE));
+}
+
+static bool lockPages(void *mem, const size_t size)
+{
+    return mlock(mem, size) == 0;
+}
+
+//prefer the node of the calling thread regardless of the process policy
+static bool bindLocal(void *mem, const size_t size)
+{
+#if defined(__linux__) && defined(SYS_mbind)
+    static const int MPOL_PREFERRED_LOCAL = 1; //MPOL_PREFERRED with an empty node mask
+    return syscall(SYS_mbind, mem, size, MPOL_PREFERRED_LOCAL, nullptr, 0, 0) == 0;
+#else
+    (void)mem;
+    (void)size;
+    return false;
+#endif
+}
+
+#endif
+
+/***********************************************************************
+ * BufferPool implementation
+ **********************************************************************/
+SoapySDR::BufferPool::BufferPool(void):
+    _mem(nullptr),
+    _memBytes(0),
+    _numBytes(0),
+    _flags(0)
+{
+    return;
+}
+
+SoapySDR::BufferPool::BufferPool(const size_t numBuffs, const size_t numBytes, const int flags):
+    BufferPool()
+{
+    if (numBytes == 0) throw std::invalid_argument("BufferPool() buffer size is zero");
+    _numBytes = numBytes;
+    if (numBuffs == 0) return;
+
+    //each buffer starts on an aligned boundary
+    const size_t stride = roundUp(numBytes, SOAPY_SDR_BUFFER_ALIGNMENT);
+    const size_t totalBytes = stride*numBuffs;
+
+    //huge pages are best-effort, fall back to normal pages when none are reserved
+    if ((flags & SOAPY_SDR_BUFFER_HUGE_PAGES) != 0)
+    {
+        const size_t pageSize = getPageSize(true);
+        if (pageSize != 0)
+        {
+            _memBytes = roundUp(totalBytes, pageSize);
+            _mem = mapPages(_memBytes, true);
+        }
+        if (_mem != nullptr) _flags |= SOAPY_SDR_BUFFER_HUGE_PAGES;
+        else SoapySDR::log(SOAPY_SDR_INFO, "BufferPool: huge pages unavailable, using normal pages");
+    }
+    if (_mem == nullptr)
+    {
+        _memBytes = roundUp(totalBytes, getPageSize(false));
+        _mem = mapPages(_memBytes, false);
+    }
+    if (_mem == nullptr)
+    {
+        throw std::runtime_error("BufferPool() failed to allocate "+std::to_string(_memBytes)+" bytes");
+    }
+
+    //the policy must be set before the pages are first touched
+    if ((flags & SOAPY_SDR_BUFFER_NUMA_LOCAL) != 0)
+    {
+        if (bindLocal(_mem, _memBytes)) _flags |= SOAPY_SDR_BUFFER_NUMA_LOCAL;
+        else SoapySDR::log(SOAPY_SDR_INFO, "BufferPool: NUMA placement unavailable");
+
+        //fault in every page from this thread so first touch places it locally as well
+        std::memset(_mem, 0, _memBytes);
+    }
+
+    if ((flags & SOAPY_SDR_BUFFER_LOCKED) != 0)
+    {
+        if (lockPages(_mem, _memBytes)) _flags |= SOAPY_SDR_BUFFER_LOCKED;
+        else SoapySDR::log(SOAPY_SDR_WARNING, "BufferPool: failed to lock buffers into memory");
+    }
+
+    for (size_t i = 0; i < numBuffs; i++) _buffs.push_back((char *)_mem + i*stride);
+}
+
+SoapySDR::BufferPool::~BufferPool(void)
+{
+    this->release();
+}
+
+SoapySDR::BufferPool::BufferPool(BufferPool &&other):
+    BufferPool()
+{
+    *this = std::move(other);
+}
+
+SoapySDR::BufferPool &SoapySDR::BufferPool::operator=(BufferPool &&other)
+{
+    if (this == &other) return *this;
+    this->release();
+    _mem = other._mem;
+    _memBytes = other._memBytes;
+    _numBytes = other._numBytes;
+    _flags = other._flags;
+    _buffs = std::move(other._buffs);
+    other._mem = nullptr;
+    other._memBytes = 0;
+    other._numBytes = 0;
+    other._flags = 0;
+    other._buffs.clear();
+    return *this;
+}
+
+void SoapySDR::BufferPool::release(void)
+{
+    //unmapping also releases the lock on the pages
+    if (_mem != nullptr) unmapPages(_mem, _memBytes);
+    _mem = nullptr;
+    _memBytes = 0;
+    _buffs.clear();
+}
+
+SoapySDR::BufferPool SoapySDR::allocateBuffers(const Device *device, Stream *stream, const std::string &format, const size_t numBuffs, const int flags)
+{
+    const size_t elemSize = SoapySDR::formatToSize(format);
+    if (elemSize == 0) throw std::invalid_argument("allocateBuffers() unknown format "+format);
+    return BufferPool(numBuffs, device->getStreamMTU(stream)*elemSize, flags);
+}
@@ -0,0 +1,52 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "ErrorHelpers.hpp"
+
+#include <SoapySDR/Buffers.h>
+#include <SoapySDR/Buffers.hpp>
+
+#include <utility>
+
+extern "C" {
+
+SoapySDRBufferPool *SoapySDRBufferPool_make(const size_t numBuffs, const size_t numBytes, const int flags)
+{
+    __SOAPY_SDR_C_TRY
+    return reinterpret_cast<SoapySDRBufferPool *>(new SoapySDR::BufferPool(numBuffs, numBytes, flags));
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+SoapySDRBufferPool *SoapySDRBufferPool_makeForStream(const SoapySDRDevice *device, SoapySDRStream *stream, const char *format, const size_t numBuffs, const int flags)
+{
+    __SOAPY_SDR_C_TRY
+    auto pool = SoapySDR::allocateBuffers(reinterpret_cast<const SoapySDR::Device *>(device), reinterpret_cast<SoapySDR::Stream *>(stream), format, numBuffs, flags);
+    return reinterpret_cast<SoapySDRBufferPool *>(new SoapySDR::BufferPool(std::move(pool)));
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+int SoapySDRBufferPool_unmake(SoapySDRBufferPool *pool)
+{
+    __SOAPY_SDR_C_TRY
+    delete reinterpret_cast<SoapySDR::BufferPool *>(pool);
+    __SOAPY_SDR_C_CATCH
+}
+
+void **SoapySDRBufferPool_getBuffers(SoapySDRBufferPool *pool, size_t *length)
+{
+    auto *bufferPool = reinterpret_cast<SoapySDR::BufferPool *>(pool);
+    *length = bufferPool->getNumBuffers();
+    return const_cast<void **>(bufferPool->getBuffers());
+}
+
+size_t SoapySDRBufferPool_getNumBytes(const SoapySDRBufferPool *pool)
+{
+    return reinterpret_cast<const SoapySDR::BufferPool *>(pool)->getNumBytes();
+}
+
+int SoapySDRBufferPool_getFlags(const SoapySDRBufferPool *pool)
+{
+    return reinterpret_cast<const SoapySDR::BufferPool *>(pool)->getFlags();
+}
+
+}
@@ -0,0 +1,78 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <cstring> //memcpy
+
+/*******************************************************************
+ * Helpers shared by the generic and vectorized converters.
+ * Everything here has internal linkage so that translation units
+ * built with wider instruction sets never share a definition.
+ ******************************************************************/
+
+/*!
+ * Find the shift equivalent to a power of two scaler.
+ * Powers of two are exact in double precision so the comparison is exact.
+ * \param scaler the converter scale factor
+ * \param maxShift the largest shift magnitude to consider
+ * \param [out] shift the left shift, negative for a right shift
+ * \return true when the scaler is a power of two within range
+ */
+static inline bool scalerToShift(const double scaler, const int maxShift, int &shift)
+{
+  double power = 1.0;
+  for (int i = 0; i <= maxShift; i++, power *= 2.0)
+  {
+    if (scaler == power) shift = i;
+    else if (scaler == 1.0/power) shift = -i;
+    else continue;
+    return true;
+  }
+  return false;
+}
+
+/*!
+ * Coefficients of the fast log2 approximation used by the dB converters.
+ * With x = m * 2^e and m in [1, 2): log2(x) ~= e + (m-1)*(c0 + c1*m + c2*m^2 + c3*m^3).
+ * The fit is constrained to be exact at m = 1 and m = 2, so the result is continuous
+ * across powers of two; the maximum error is about 1.5e-4 (4.4e-4 dB).
+ * A zero input yields -127 rather than -inf.
+ */
+static const float FAST_LOG2_C0 = 2.51014793f;
+static const float FAST_LOG2_C1 = -1.54969002f;
+static const float FAST_LOG2_C2 = 0.557922632f;
+static const float FAST_LOG2_C3 = -0.0803073037f;
+
+//! Scale from log2 of a power to decibels: 10*log10(2)
+static const float LOG2_TO_DB = 3.01029996f;
+
+//! Fast log2 approximation for non-negative finite inputs
+static inline float fastLog2(const float x)
+{
+  uint32_t bits;
+  std::memcpy(&bits, &x, sizeof(bits));
+  const float e = float(int32_t(bits >> 23) - 127);
+  bits = (bits & 0x007fffff) | 0x3f800000;
+  float m;
+  std::memcpy(&m, &bits, sizeof(m));
+  return e + (m - 1.0f)*(((FAST_LOG2_C3*m + FAST_LOG2_C2)*m + FAST_LOG2_C1)*m + FAST_LOG2_C0);
+}
+
+/*!
+ * Normalize the output of a CIC decimator to unity gain at DC.
+ * The filter gain is factor^order, and the full scale of the
+ * integer input maps to 1.0 before the converter scaler applies.
+ * \param factor the decimation factor
+ * \param order the number of integrator and comb stages
+ * \param inputBits the number of magnitude bits of the input samples
+ * \param scaler the converter scale factor
+ * \return the multiplier from the comb output to the target full scale
+ */
+static inline double decimateNorm(const size_t factor, const size_t order, const int inputBits, const double scaler)
+{
+  double gain = double(uint64_t(1) << inputBits);
+  for (size_t i = 0; i < order; i++) gain *= double(factor);
+  return scaler/gain;
+}
@@ -5,38 +5,210 @@
 #include <SoapySDR/ConverterRegistry.hpp>
 #include <algorithm>
 #include <stdexcept>
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#include <limits>
+#include <fstream>
+#include <sstream>
+#include <cstdio> //rename, remove
+#include <cstring> //memcpy
+#include <set>
+
+#ifdef _WIN32
+#include <direct.h> //_mkdir
+#else
+#include <sys/stat.h> //mkdir
+#include <unistd.h> //gethostname
+#endif
+
+#if defined(__GNUC__) || defined(__clang__)
+#define SOAPY_SDR_PREFETCH(p) __builtin_prefetch(p)
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <xmmintrin.h>
+#define SOAPY_SDR_PREFETCH(p) _mm_prefetch((const char *)(p), _MM_HINT_T0)
+#else
+#define SOAPY_SDR_PREFETCH(p)
+#endif
+
+static const size_t CACHE_LINE_BYTES = 64;
+static const size_t PREFETCH_BYTES = 4*CACHE_LINE_BYTES;
+
+//each block of a conversion chain fits in L1 along with its input and output
+static const size_t PATH_SCRATCH_BYTES = 16*1024;
 
 void lateLoadDefaultConverters(void);
 
-static SoapySDR::ConverterRegistry::FormatConverters formatConverters;
+std::string getEnvImpl(const char *name);
+
+/***********************************************************************
+ * Registry storage
+ *
+ * Lookups read an immutable snapshot through an atomic pointer.
+ * Registrations update the pending tables under a mutex and bump
+ * the version; the next lookup that sees a stale snapshot publishes
+ * a new copy, so a burst of registrations costs a single copy.
+ * Tuning and wisdom results are stored with one bump per call,
+ * and none when they leave the table unchanged.
+ * Readers may still hold an old snapshot, so retired snapshots are
+ * kept for the lifetime of the process instead of being freed.
+ **********************************************************************/
+template <typename T>
+using FormatTable = std::map<std::string, std::map<std::string, std::map<SoapySDR::ConverterRegistry::FunctionPriority, T>>>;
 
-SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction)
+//the fastest priority found by tuning a conversion,
+//valid while the registered candidates match the signature
+struct TunedPriority
 {
-  if (formatConverters.count(sourceFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat].count(targetFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat][targetFormat].count(priority) != 0)
+  SoapySDR::ConverterRegistry::FunctionPriority priority;
+  std::string signature;
+};
+
+struct ConverterSnapshot
+{
+  size_t version;
+  SoapySDR::ConverterRegistry::FormatConverters converters;
+  FormatTable<std::string> instructionSets;
+  FormatTable<bool> inPlace;
+  FormatTable<SoapySDR::ConverterRegistry::DeinterleaveFunction> deinterleavers;
+  FormatTable<SoapySDR::ConverterRegistry::InterleaveFunction> interleavers;
+  FormatTable<SoapySDR::ConverterRegistry::DecimateFunction> decimators;
+  std::map<std::string, std::map<std::string, TunedPriority>> tuned;
+};
+
+struct PendingRegistry : ConverterSnapshot
+{
+  std::vector<const ConverterSnapshot *> retired;
+};
+
+static std::mutex registryMutex;
+
+static std::atomic<size_t> registryVersion(0);
+
+static std::atomic<const ConverterSnapshot *> registrySnapshot(nullptr);
+
+static PendingRegistry &getPendingRegistry(void)
+{
+  //constructed on first use for registrations during static initialization
+  static PendingRegistry *pending = new PendingRegistry();
+  return *pending;
+}
+
+static void lateLoadWisdom(void)
+{
+  static const bool loaded = SoapySDR::ConverterRegistry::loadWisdom(SoapySDR::ConverterRegistry::getWisdomPath());
+  (void)loaded;
+}
+
+static const ConverterSnapshot &getSnapshot(void)
+{
+  lateLoadDefaultConverters();
+  lateLoadWisdom();
+
+  //fast path: the published snapshot is current
+  const ConverterSnapshot *snapshot = registrySnapshot.load(std::memory_order_acquire);
+  if (snapshot != nullptr and snapshot->version == registryVersion.load(std::memory_order_acquire)) return *snapshot;
+
+  std::lock_guard<std::mutex> lock(registryMutex);
+  auto &pending = getPendingRegistry();
+  snapshot = registrySnapshot.load(std::memory_order_relaxed);
+  if (snapshot != nullptr and snapshot->version == pending.version) return *snapshot;
+
+  if (snapshot != nullptr) pending.retired.push_back(snapshot);
+  snapshot = new ConverterSnapshot(pending);
+  registrySnapshot.store(snapshot, std::memory_order_release);
+  return *snapshot;
+}
+
+//find the priority map for a conversion or nullptr when not registered
+static const SoapySDR::ConverterRegistry::TargetFormatConverterPriority *findPriorities(const ConverterSnapshot &snapshot, const std::string &sourceFormat, const std::string &targetFormat)
+{
+  const auto sourceIt = snapshot.converters.find(sourceFormat);
+  if (sourceIt == snapshot.converters.end()) return nullptr;
+  const auto targetIt = sourceIt->second.find(targetFormat);
+  if (targetIt == sourceIt->second.end()) return nullptr;
+  return &targetIt->second;
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction):
+  ConverterRegistry(sourceFormat, targetFormat, priority, converterFunction, "")
+{
+  return;
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction, const std::string &instructionSet):
+  ConverterRegistry(sourceFormat, targetFormat, priority, converterFunction, instructionSet, false)
+{
+  return;
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, ConverterFunction converterFunction, const std::string &instructionSet, const bool inPlace)
+{
+  std::lock_guard<std::mutex> lock(registryMutex);
+  auto &pending = getPendingRegistry();
+
+  auto &priorities = pending.converters[sourceFormat][targetFormat];
+  if (priorities.count(priority) != 0)
     {
       SoapySDR::logf(SOAPY_SDR_ERROR, "SoapySDR::ConverterRegistry(%s, %s, %s) duplicate registration", sourceFormat.c_str(), targetFormat.c_str(), std::to_string(priority).c_str());
       return;
     }
   
-  formatConverters[sourceFormat][targetFormat][priority] = converterFunction;
+  priorities[priority] = converterFunction;
+  pending.instructionSets[sourceFormat][targetFormat][priority] = instructionSet;
+  pending.inPlace[sourceFormat][targetFormat][priority] = inPlace;
+  pending.version++;
+  registryVersion.store(pending.version, std::memory_order_release);
 
   return;
 }
 
+//register a channel layout function in one of the pending tables
+template <typename Fcn>
+static void registerLayoutFunction(FormatTable<Fcn> &table, const char *what, const std::string &sourceFormat, const std::string &targetFormat, const SoapySDR::ConverterRegistry::FunctionPriority &priority, Fcn function)
+{
+  auto &priorities = table[sourceFormat][targetFormat];
+  if (priorities.count(priority) != 0)
+    {
+      SoapySDR::logf(SOAPY_SDR_ERROR, "SoapySDR::ConverterRegistry(%s, %s, %s) duplicate %s registration", sourceFormat.c_str(), targetFormat.c_str(), std::to_string(priority).c_str(), what);
+      return;
+    }
+
+  priorities[priority] = function;
+  auto &pending = getPendingRegistry();
+  pending.version++;
+  registryVersion.store(pending.version, std::memory_order_release);
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, DeinterleaveFunction deinterleaver)
+{
+  std::lock_guard<std::mutex> lock(registryMutex);
+  registerLayoutFunction(getPendingRegistry().deinterleavers, "deinterleave", sourceFormat, targetFormat, priority, deinterleaver);
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, InterleaveFunction interleaver)
+{
+  std::lock_guard<std::mutex> lock(registryMutex);
+  registerLayoutFunction(getPendingRegistry().interleavers, "interleave", sourceFormat, targetFormat, priority, interleaver);
+}
+
+SoapySDR::ConverterRegistry::ConverterRegistry(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority, DecimateFunction decimator)
+{
+  std::lock_guard<std::mutex> lock(registryMutex);
+  registerLayoutFunction(getPendingRegistry().decimators, "decimate", sourceFormat, targetFormat, priority, decimator);
+}
+
 std::vector<std::string> SoapySDR::ConverterRegistry::listTargetFormats(const std::string &sourceFormat)
 {
-  lateLoadDefaultConverters();
+  const auto &snapshot = getSnapshot();
 
   std::vector<std::string> targets;
 
-  if (formatConverters.count(sourceFormat) == 0)
+  const auto sourceIt = snapshot.converters.find(sourceFormat);
+  if (sourceIt == snapshot.converters.end())
     return targets;
 
-  for(const auto &it:formatConverters[sourceFormat])
+  for(const auto &it:sourceIt->second)
     {
       std::string targetFormat = it.first;
       targets.push_back(targetFormat);
@@ -48,14 +220,14 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listTargetFormats(const st
 
 std::vector<std::string> SoapySDR::ConverterRegistry::listSourceFormats(const std::string &targetFormat)
 {
-  lateLoadDefaultConverters();
+  const auto &snapshot = getSnapshot();
 
   std::vector<std::string> sources;
 
-  for(const auto &it:formatConverters)
+  for(const auto &it:snapshot.converters)
     {
       std::string sourceFormat = it.first;
-      if (formatConverters[sourceFormat].count(targetFormat) > 0)
+      if (it.second.count(targetFormat) > 0)
         sources.push_back(sourceFormat);
     }
   
@@ -65,19 +237,16 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listSourceFormats(const st
 
 std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRegistry::listPriorities(const std::string &sourceFormat, const std::string &targetFormat)
 {
-  lateLoadDefaultConverters();
+  const auto &snapshot = getSnapshot();
 
   std::vector<FunctionPriority> priorities;
   
-  if (formatConverters.count(sourceFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat].count(targetFormat) == 0)
-    ;
-  else if (formatConverters[sourceFormat][targetFormat].size() == 0)
+  const auto converters = findPriorities(snapshot, sourceFormat, targetFormat);
+  if (converters == nullptr)
     ;
   else
     {
-      for(const auto &it:formatConverters[sourceFormat][targetFormat])
+      for(const auto &it:*converters)
         {
           FunctionPriority priority = it.first;
           priorities.push_back(priority);
@@ -88,62 +257,86 @@ std::vector<SoapySDR::ConverterRegistry::FunctionPriority> SoapySDR::ConverterRe
   
 }
 
+std::string SoapySDR::ConverterRegistry::getInstructionSet(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  //validates the registration and throws when missing
+  getFunction(sourceFormat, targetFormat, priority);
+
+  const auto &snapshot = getSnapshot();
+  return snapshot.instructionSets.at(sourceFormat).at(targetFormat).at(priority);
+}
+
+bool SoapySDR::ConverterRegistry::isInPlace(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  //validates the registration and throws when missing
+  getFunction(sourceFormat, targetFormat, priority);
+
+  const auto &snapshot = getSnapshot();
+  return snapshot.inPlace.at(sourceFormat).at(targetFormat).at(priority);
+}
+
 SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat)
 {
-  lateLoadDefaultConverters();
+  const auto &snapshot = getSnapshot();
 
-  if (formatConverters.count(sourceFormat) == 0)
+  const auto sourceIt = snapshot.converters.find(sourceFormat);
+  if (sourceIt == snapshot.converters.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion source not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
     }
   
-  if (formatConverters[sourceFormat].count(targetFormat) == 0)
+  const auto targetIt = sourceIt->second.find(targetFormat);
+  if (targetIt == sourceIt->second.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion target not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
     }
 
-  if (formatConverters[sourceFormat][targetFormat].size() == 0)
+  if (targetIt->second.size() == 0)
     {
       throw std::runtime_error("ConverterRegistry::getFunction() no functions found for registered conversion; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
     }
 
-  return formatConverters[sourceFormat][targetFormat].rbegin()->second;
+  if (targetIt->second.size() == 1) return targetIt->second.begin()->second;
+  return targetIt->second.at(getSelectedPriority(sourceFormat, targetFormat));
 }
 
 SoapySDR::ConverterRegistry::ConverterFunction SoapySDR::ConverterRegistry::getFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
 {
-  lateLoadDefaultConverters();
+  const auto &snapshot = getSnapshot();
 
-  if (formatConverters.count(sourceFormat) == 0)
+  const auto sourceIt = snapshot.converters.find(sourceFormat);
+  if (sourceIt == snapshot.converters.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion source not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
     }
 
-  if (formatConverters[sourceFormat].count(targetFormat) == 0)
+  const auto targetIt = sourceIt->second.find(targetFormat);
+  if (targetIt == sourceIt->second.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion target not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
     }
 
-  if (formatConverters[sourceFormat][targetFormat].count(priority) == 0)
+  const auto priorityIt = targetIt->second.find(priority);
+  if (priorityIt == targetIt->second.end())
     {
       throw std::runtime_error("ConverterRegistry::getFunction() conversion priority not registered; "
                                "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+", priority="+std::to_string(priority));
     }
 
-  return formatConverters[sourceFormat][targetFormat][priority];
+  return priorityIt->second;
 }
 
 std::vector<std::string> SoapySDR::ConverterRegistry::listAvailableSourceFormats(void)
 {
-    lateLoadDefaultConverters();
+    const auto &snapshot = getSnapshot();
 
     std::vector<std::string> sources;
-    for (const auto &it : formatConverters)
+    for (const auto &it : snapshot.converters)
     {
         if (std::find(sources.begin(), sources.end(), it.first) == sources.end())
         {
@@ -153,3 +346,618 @@ std::vector<std::string> SoapySDR::ConverterRegistry::listAvailableSourceFormats
     std::sort(sources.begin(), sources.end());
     return sources;
 }
+
+//find a channel layout function with the highest or a given priority
+template <typename Fcn>
+static Fcn findLayoutFunction(const FormatTable<Fcn> &table, const char *name, const std::string &sourceFormat, const std::string &targetFormat, const SoapySDR::ConverterRegistry::FunctionPriority *priority)
+{
+  const auto sourceIt = table.find(sourceFormat);
+  const bool hasTarget = (sourceIt != table.end() and sourceIt->second.count(targetFormat) != 0);
+  if (hasTarget)
+    {
+      const auto &priorities = sourceIt->second.at(targetFormat);
+      if (priority == nullptr and not priorities.empty()) return priorities.rbegin()->second;
+      if (priority != nullptr and priorities.count(*priority) != 0) return priorities.at(*priority);
+    }
+
+  throw std::runtime_error(std::string("ConverterRegistry::")+name+"() conversion not registered; "
+                           "sourceFormat="+sourceFormat+", targetFormat="+targetFormat+
+                           ((priority == nullptr)?"":", priority="+std::to_string(*priority)));
+}
+
+SoapySDR::ConverterRegistry::DeinterleaveFunction SoapySDR::ConverterRegistry::getDeinterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return findLayoutFunction(getSnapshot().deinterleavers, "getDeinterleaveFunction", sourceFormat, targetFormat, nullptr);
+}
+
+SoapySDR::ConverterRegistry::DeinterleaveFunction SoapySDR::ConverterRegistry::getDeinterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  return findLayoutFunction(getSnapshot().deinterleavers, "getDeinterleaveFunction", sourceFormat, targetFormat, &priority);
+}
+
+SoapySDR::ConverterRegistry::InterleaveFunction SoapySDR::ConverterRegistry::getInterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return findLayoutFunction(getSnapshot().interleavers, "getInterleaveFunction", sourceFormat, targetFormat, nullptr);
+}
+
+SoapySDR::ConverterRegistry::InterleaveFunction SoapySDR::ConverterRegistry::getInterleaveFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  return findLayoutFunction(getSnapshot().interleavers, "getInterleaveFunction", sourceFormat, targetFormat, &priority);
+}
+
+SoapySDR::ConverterRegistry::DecimateFunction SoapySDR::ConverterRegistry::getDecimateFunction(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return findLayoutFunction(getSnapshot().decimators, "getDecimateFunction", sourceFormat, targetFormat, nullptr);
+}
+
+SoapySDR::ConverterRegistry::DecimateFunction SoapySDR::ConverterRegistry::getDecimateFunction(const std::string &sourceFormat, const std::string &targetFormat, const FunctionPriority &priority)
+{
+  return findLayoutFunction(getSnapshot().decimators, "getDecimateFunction", sourceFormat, targetFormat, &priority);
+}
+
+static bool formatIsFloat(const std::string &format)
+{
+  const size_t typeIndex = (not format.empty() and format.front() == 'C')?1:0;
+  return format.size() > typeIndex and format[typeIndex] == 'F';
+}
+
+//bits of precision per component, floating point formats count the mantissa
+static size_t formatPrecision(const std::string &format)
+{
+  const bool isComplex = (not format.empty() and format.front() == 'C');
+  const size_t bits = (SoapySDR::formatToSize(format)*8)/(isComplex?2:1);
+  if (not formatIsFloat(format)) return bits;
+  if (bits == 64) return 53;
+  if (bits == 32) return 24;
+  return bits/2;
+}
+
+std::vector<std::string> SoapySDR::ConverterRegistry::findPath(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  const auto &snapshot = getSnapshot();
+  if (findPriorities(snapshot, sourceFormat, targetFormat) != nullptr) return {sourceFormat, targetFormat};
+
+  //shortest path search where each conversion costs the bytes it moves per element
+  const size_t minPrecision = std::min(formatPrecision(sourceFormat), formatPrecision(targetFormat));
+  std::map<std::string, size_t> costs{{sourceFormat, 0}};
+  std::map<std::string, std::string> previous;
+  std::set<std::pair<size_t, std::string>> queue{{0, sourceFormat}};
+  while (not queue.empty())
+    {
+      const auto cost = queue.begin()->first;
+      const auto format = queue.begin()->second;
+      queue.erase(queue.begin());
+      if (format == targetFormat) break;
+
+      const auto sourceIt = snapshot.converters.find(format);
+      if (sourceIt == snapshot.converters.end()) continue;
+      for (const auto &it : sourceIt->second)
+        {
+          //intermediate formats need a known size and enough precision
+          const auto &next = it.first;
+          if (it.second.empty()) continue;
+          if (next != targetFormat and (SoapySDR::formatToSize(next) == 0 or formatPrecision(next) < minPrecision)) continue;
+
+          const size_t nextCost = cost + SoapySDR::formatToSize(format) + SoapySDR::formatToSize(next);
+          const auto costIt = costs.find(next);
+          if (costIt != costs.end() and costIt->second <= nextCost) continue;
+          if (costIt != costs.end()) queue.erase(std::make_pair(costIt->second, next));
+          costs[next] = nextCost;
+          previous[next] = format;
+          queue.insert(std::make_pair(nextCost, next));
+        }
+    }
+
+  std::vector<std::string> path;
+  if (costs.count(targetFormat) == 0) return path;
+  for (auto format = targetFormat; format != sourceFormat; format = previous.at(format)) path.push_back(format);
+  path.push_back(sourceFormat);
+  std::reverse(path.begin(), path.end());
+  return path;
+}
+
+void SoapySDR::ConverterRegistry::convertChannels(ConverterFunction converter, const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+  for (size_t i = 0; i < numChans; i++)
+    {
+      //start pulling in the head of the next channel while this one converts
+      if (i+1 < numChans)
+        {
+          auto *next = (const char *)srcBuffs[i+1];
+          for (size_t j = 0; j < PREFETCH_BYTES; j += CACHE_LINE_BYTES) SOAPY_SDR_PREFETCH(next+j);
+        }
+      converter(srcBuffs[i], dstBuffs[i], numElems, scaler);
+    }
+}
+
+//a chain of conversions shared by prepared converters
+struct SoapySDR::PreparedConverter::Path
+{
+  size_t version;
+  std::vector<std::string> formats;
+  std::vector<ConverterRegistry::ConverterFunction> functions;
+  ConverterRegistry::FunctionPriority priority;
+  std::string instructionSet;
+  size_t blockElems;
+  size_t scalerHop;
+};
+
+SoapySDR::PreparedConverter::PreparedConverter(void):
+  _function(nullptr),
+  _scaler(1.0),
+  _sourceElemSize(0),
+  _targetElemSize(0),
+  _priority(ConverterRegistry::GENERIC),
+  _inPlace(false)
+{
+  return;
+}
+
+SoapySDR::PreparedConverter::PreparedConverter(const std::string &sourceFormat, const std::string &targetFormat, const double scaler):
+  PreparedConverter()
+{
+  if (not ConverterRegistry::listPriorities(sourceFormat, targetFormat).empty())
+    {
+      *this = PreparedConverter(sourceFormat, targetFormat, ConverterRegistry::getSelectedPriority(sourceFormat, targetFormat), scaler);
+      return;
+    }
+
+  //chains are shared between converters until the registry changes
+  static std::mutex cacheMutex;
+  static std::map<std::pair<std::string, std::string>, std::shared_ptr<const Path>> cache;
+  const auto key = std::make_pair(sourceFormat, targetFormat);
+  {
+    std::lock_guard<std::mutex> lock(cacheMutex);
+    const auto it = cache.find(key);
+    if (it != cache.end() and it->second->version == registryVersion.load(std::memory_order_acquire)) _path = it->second;
+  }
+
+  if (not _path)
+    {
+      const size_t version = registryVersion.load(std::memory_order_acquire);
+      const auto formats = ConverterRegistry::findPath(sourceFormat, targetFormat);
+      if (formats.empty())
+        {
+          throw std::runtime_error("PreparedConverter() conversion not registered; "
+                                   "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+        }
+
+      std::shared_ptr<Path> path(new Path());
+      path->version = version;
+      path->formats = formats;
+      path->priority = ConverterRegistry::CUSTOM;
+      path->scalerHop = formats.size();
+      size_t maxElemSize(1);
+      for (size_t i = 0; i+1 < formats.size(); i++)
+        {
+          const auto priority = ConverterRegistry::getSelectedPriority(formats[i], formats[i+1]);
+          const auto instructionSet = ConverterRegistry::getInstructionSet(formats[i], formats[i+1], priority);
+          path->functions.push_back(ConverterRegistry::getFunction(formats[i], formats[i+1], priority));
+          path->priority = std::min(path->priority, priority);
+          if (not instructionSet.empty() and (","+path->instructionSet+",").find(","+instructionSet+",") == std::string::npos)
+            {
+              path->instructionSet += (path->instructionSet.empty()?"":",")+instructionSet;
+            }
+          if (i > 0) maxElemSize = std::max(maxElemSize, SoapySDR::formatToSize(formats[i]));
+
+          //scale where the output is floating point so the scaler cannot truncate
+          if (path->scalerHop == formats.size() and formatIsFloat(formats[i+1])) path->scalerHop = i;
+        }
+      path->blockElems = PATH_SCRATCH_BYTES/maxElemSize;
+      if (path->scalerHop == formats.size()) path->scalerHop = 0;
+
+      std::lock_guard<std::mutex> lock(cacheMutex);
+      cache[key] = path;
+      _path = path;
+    }
+
+  _scaler = scaler;
+  _sourceElemSize = SoapySDR::formatToSize(sourceFormat);
+  _targetElemSize = SoapySDR::formatToSize(targetFormat);
+  _priority = _path->priority;
+  _sourceFormat = sourceFormat;
+  _targetFormat = targetFormat;
+  _instructionSet = _path->instructionSet;
+  _inPlace = true;
+}
+
+SoapySDR::PreparedConverter::PreparedConverter(const std::string &sourceFormat, const std::string &targetFormat, const ConverterRegistry::FunctionPriority &priority, const double scaler):
+  _function(ConverterRegistry::getFunction(sourceFormat, targetFormat, priority)),
+  _scaler(scaler),
+  _sourceElemSize(SoapySDR::formatToSize(sourceFormat)),
+  _targetElemSize(SoapySDR::formatToSize(targetFormat)),
+  _priority(priority),
+  _sourceFormat(sourceFormat),
+  _targetFormat(targetFormat),
+  _instructionSet(ConverterRegistry::getInstructionSet(sourceFormat, targetFormat, priority)),
+  _inPlace(ConverterRegistry::isInPlace(sourceFormat, targetFormat, priority))
+{
+  return;
+}
+
+std::vector<std::string> SoapySDR::PreparedConverter::getPath(void) const
+{
+  if (_path) return _path->formats;
+  if (_function == nullptr) return std::vector<std::string>();
+  return {_sourceFormat, _targetFormat};
+}
+
+void SoapySDR::PreparedConverter::convertPath(const void *srcBuff, void *dstBuff, const size_t numElems) const
+{
+  //intermediate formats alternate between two scratch buffers
+  static thread_local std::vector<char> scratch[2];
+  for (auto &buff : scratch) if (buff.size() < PATH_SCRATCH_BYTES) buff.resize(PATH_SCRATCH_BYTES);
+
+  const auto &path = *_path;
+  const size_t numHops = path.functions.size();
+  const size_t numBlocks = (numElems+path.blockElems-1)/path.blockElems;
+
+  //the first hop reads a whole block before the last hop writes it,
+  //so an in-place widening chain only has to work from the end backwards
+  const bool backwards = srcBuff == dstBuff and _targetElemSize > _sourceElemSize;
+  for (size_t block = 0; block < numBlocks; block++)
+    {
+      const size_t offset = (backwards?(numBlocks-1-block):block)*path.blockElems;
+      const size_t n = std::min(path.blockElems, numElems-offset);
+      const void *in = (const char *)srcBuff + offset*_sourceElemSize;
+      for (size_t hop = 0; hop < numHops; hop++)
+        {
+          void *out = (hop+1 == numHops)?((char *)dstBuff + offset*_targetElemSize):scratch[hop%2].data();
+          path.functions[hop](in, out, n, (hop == path.scalerHop)?_scaler:1.0);
+          in = out;
+        }
+    }
+}
+
+void SoapySDR::PreparedConverter::convertInPlace(void *buff, const size_t numElems) const
+{
+  //the blocks are sized from the formats, so custom formats without a known size cannot be staged
+  if (_sourceElemSize == 0 or _targetElemSize == 0)
+    {
+      throw std::runtime_error("PreparedConverter::convert() in place needs a known format size; "
+                               "sourceFormat="+_sourceFormat+", targetFormat="+_targetFormat);
+    }
+
+  //each block of input is copied aside before the function overwrites it
+  static thread_local std::vector<char> scratch;
+  if (scratch.size() < PATH_SCRATCH_BYTES) scratch.resize(PATH_SCRATCH_BYTES);
+
+  //narrowing output never reaches input that is not yet copied when working forwards,
+  //and widening output never reaches it when working from the end backwards
+  const size_t blockElems = PATH_SCRATCH_BYTES/_sourceElemSize;
+  const size_t numBlocks = (numElems+blockElems-1)/blockElems;
+  const bool backwards = _targetElemSize > _sourceElemSize;
+  for (size_t block = 0; block < numBlocks; block++)
+    {
+      const size_t offset = (backwards?(numBlocks-1-block):block)*blockElems;
+      const size_t n = std::min(blockElems, numElems-offset);
+      std::memcpy(scratch.data(), (const char *)buff + offset*_sourceElemSize, n*_sourceElemSize);
+      _function(scratch.data(), (char *)buff + offset*_targetElemSize, n, _scaler);
+    }
+}
+
+/***********************************************************************
+ * Prepared decimator
+ **********************************************************************/
+const size_t SoapySDR::ConverterRegistry::DECIMATE_ORDER;
+const size_t SoapySDR::ConverterRegistry::DECIMATE_MAX_FACTOR;
+
+SoapySDR::PreparedDecimator::PreparedDecimator(void):
+  _function(nullptr),
+  _factor(1),
+  _scaler(1.0),
+  _sourceElemSize(0),
+  _targetElemSize(0),
+  _state()
+{
+  return;
+}
+
+SoapySDR::PreparedDecimator::PreparedDecimator(const std::string &sourceFormat, const std::string &targetFormat, const size_t factor, const double scaler):
+  _function(ConverterRegistry::getDecimateFunction(sourceFormat, targetFormat)),
+  _factor(factor),
+  _scaler(scaler),
+  _sourceElemSize(SoapySDR::formatToSize(sourceFormat)),
+  _targetElemSize(SoapySDR::formatToSize(targetFormat)),
+  _state()
+{
+  if (factor == 0 or factor > ConverterRegistry::DECIMATE_MAX_FACTOR)
+    {
+      throw std::invalid_argument("PreparedDecimator() factor out of range; factor="+std::to_string(factor));
+    }
+}
+
+void SoapySDR::PreparedDecimator::reset(void)
+{
+  _state = ConverterRegistry::DecimateState();
+}
+
+/***********************************************************************
+ * Tuning and wisdom
+ *
+ * Tuning times every registered priority of a conversion and records
+ * the fastest along with a signature of the candidates that were timed.
+ * The wisdom file holds one conversion per line:
+ *   sourceFormat targetFormat priority signature...
+ * where the signature lists each candidate as priority:instructionSet.
+ * A result only applies while the registered candidates still match,
+ * so new converters or another processor invalidate stale results.
+ **********************************************************************/
+static const size_t TUNE_NUM_ELEMS = 4096;
+static const size_t TUNE_NUM_ITERS = 32;
+static const size_t TUNE_NUM_ROUNDS = 5;
+
+static std::string candidateSignature(const ConverterSnapshot &snapshot, const std::string &sourceFormat, const std::string &targetFormat)
+{
+  std::string signature;
+  if (findPriorities(snapshot, sourceFormat, targetFormat) == nullptr) return signature;
+  const auto &instructionSets = snapshot.instructionSets.at(sourceFormat).at(targetFormat);
+  for (const auto &it : *findPriorities(snapshot, sourceFormat, targetFormat))
+    {
+      if (not signature.empty()) signature += " ";
+      signature += std::to_string(it.first) + ":" + instructionSets.at(it.first);
+    }
+  return signature;
+}
+
+//find a valid tuning result or nullptr when the conversion is untuned
+static const TunedPriority *findTuned(const ConverterSnapshot &snapshot, const std::string &sourceFormat, const std::string &targetFormat)
+{
+  const auto sourceIt = snapshot.tuned.find(sourceFormat);
+  if (sourceIt == snapshot.tuned.end()) return nullptr;
+  const auto targetIt = sourceIt->second.find(targetFormat);
+  if (targetIt == sourceIt->second.end()) return nullptr;
+  if (targetIt->second.signature != candidateSignature(snapshot, sourceFormat, targetFormat)) return nullptr;
+  return &targetIt->second;
+}
+
+static bool tuneOnFirstUse(void)
+{
+  static const bool enabled = (getEnvImpl("SOAPY_SDR_CONVERTER_TUNE") == "1");
+  return enabled;
+}
+
+//the timing buffers are sized from the formats, so custom formats without a known size cannot be tuned
+static bool canMeasure(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  return SoapySDR::formatToSize(sourceFormat) != 0 and SoapySDR::formatToSize(targetFormat) != 0;
+}
+
+SoapySDR::ConverterRegistry::FunctionPriority SoapySDR::ConverterRegistry::getSelectedPriority(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  const auto &snapshot = getSnapshot();
+
+  const auto priorities = findPriorities(snapshot, sourceFormat, targetFormat);
+  if (priorities == nullptr or priorities->empty())
+    {
+      throw std::runtime_error("ConverterRegistry::getSelectedPriority() conversion not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+    }
+
+  if (priorities->size() == 1) return priorities->begin()->first;
+
+  const auto tuned = findTuned(snapshot, sourceFormat, targetFormat);
+  if (tuned != nullptr) return tuned->priority;
+
+  if (tuneOnFirstUse() and canMeasure(sourceFormat, targetFormat))
+    {
+      const auto priority = tune(sourceFormat, targetFormat);
+      saveWisdom(getWisdomPath());
+      return priority;
+    }
+
+  return priorities->rbegin()->first;
+}
+
+typedef std::pair<std::pair<std::string, std::string>, TunedPriority> TunedEntry;
+
+//store tuning results with a single version bump, since every bump copies the registry;
+//results that match the table already are skipped, so repeated tuning publishes nothing
+static void storeTuned(const std::vector<TunedEntry> &entries)
+{
+  std::lock_guard<std::mutex> lock(registryMutex);
+  auto &pending = getPendingRegistry();
+  bool changed = false;
+  for (const auto &entry : entries)
+    {
+      auto &targets = pending.tuned[entry.first.first];
+      const auto it = targets.find(entry.first.second);
+      if (it != targets.end() and it->second.priority == entry.second.priority and it->second.signature == entry.second.signature) continue;
+      targets[entry.first.second] = entry.second;
+      changed = true;
+    }
+  if (not changed) return;
+  pending.version++;
+  registryVersion.store(pending.version, std::memory_order_release);
+}
+
+//time every candidate of a conversion and return the fastest
+static TunedEntry measureFastest(const ConverterSnapshot &snapshot, const std::string &sourceFormat, const std::string &targetFormat)
+{
+  const auto priorities = findPriorities(snapshot, sourceFormat, targetFormat);
+  if (priorities == nullptr or priorities->empty())
+    {
+      throw std::runtime_error("ConverterRegistry::tune() conversion not registered; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+    }
+  if (not canMeasure(sourceFormat, targetFormat))
+    {
+      throw std::runtime_error("ConverterRegistry::tune() format size unknown; "
+                               "sourceFormat="+sourceFormat+", targetFormat="+targetFormat);
+    }
+
+  //zeroed buffers sized like a typical stream MTU so both fit in cache
+  std::vector<char> srcBuff(SoapySDR::formatToSize(sourceFormat)*TUNE_NUM_ELEMS);
+  std::vector<char> dstBuff(SoapySDR::formatToSize(targetFormat)*TUNE_NUM_ELEMS);
+
+  //keep the best round of each candidate to reject interruptions
+  SoapySDR::ConverterRegistry::FunctionPriority fastest(priorities->rbegin()->first);
+  double fastestTime(std::numeric_limits<double>::max());
+  for (const auto &it : *priorities)
+    {
+      it.second(srcBuff.data(), dstBuff.data(), TUNE_NUM_ELEMS, 1.0);
+      for (size_t round = 0; round < TUNE_NUM_ROUNDS; round++)
+        {
+          const auto t0 = std::chrono::high_resolution_clock::now();
+          for (size_t i = 0; i < TUNE_NUM_ITERS; i++) it.second(srcBuff.data(), dstBuff.data(), TUNE_NUM_ELEMS, 1.0);
+          const auto t1 = std::chrono::high_resolution_clock::now();
+          const double elapsed = std::chrono::duration<double>(t1-t0).count();
+          if (elapsed < fastestTime)
+            {
+              fastestTime = elapsed;
+              fastest = it.first;
+            }
+        }
+    }
+
+  SoapySDR::logf(SOAPY_SDR_DEBUG, "ConverterRegistry: tuned %s -> %s using priority %d (%g ns/sample)",
+                 sourceFormat.c_str(), targetFormat.c_str(), int(fastest), (fastestTime*1e9)/(TUNE_NUM_ITERS*TUNE_NUM_ELEMS));
+
+  TunedPriority tuned;
+  tuned.priority = fastest;
+  tuned.signature = candidateSignature(snapshot, sourceFormat, targetFormat);
+  return std::make_pair(std::make_pair(sourceFormat, targetFormat), tuned);
+}
+
+SoapySDR::ConverterRegistry::FunctionPriority SoapySDR::ConverterRegistry::tune(const std::string &sourceFormat, const std::string &targetFormat)
+{
+  const auto entry = measureFastest(getSnapshot(), sourceFormat, targetFormat);
+  storeTuned(std::vector<TunedEntry>(1, entry));
+  return entry.second.priority;
+}
+
+void SoapySDR::ConverterRegistry::tune(void)
+{
+  //measure everything against one snapshot, then publish all results at once
+  const auto &snapshot = getSnapshot();
+  std::vector<TunedEntry> entries;
+  for (const auto &source : snapshot.converters)
+    {
+      for (const auto &target : source.second)
+        {
+          if (target.second.size() > 1 and canMeasure(source.first, target.first)) entries.push_back(measureFastest(snapshot, source.first, target.first));
+        }
+    }
+  storeTuned(entries);
+}
+
+std::string SoapySDR::ConverterRegistry::getWisdomPath(void)
+{
+  const std::string wisdomEnv = getEnvImpl("SOAPY_SDR_CONVERTER_WISDOM");
+  if (not wisdomEnv.empty()) return wisdomEnv;
+
+  #ifdef _WIN32
+  const std::string cacheDir = getEnvImpl("LOCALAPPDATA");
+  const std::string hostName = getEnvImpl("COMPUTERNAME");
+  #else
+  std::string cacheDir = getEnvImpl("XDG_CACHE_HOME");
+  if (cacheDir.empty() and not getEnvImpl("HOME").empty()) cacheDir = getEnvImpl("HOME") + "/.cache";
+  char hostBuff[256] = {};
+  const std::string hostName((gethostname(hostBuff, sizeof(hostBuff)-1) == 0)?hostBuff:"");
+  #endif
+
+  if (cacheDir.empty()) return "";
+  return cacheDir + "/SoapySDR/converter_wisdom" + (hostName.empty()?"":"_"+hostName) + ".txt";
+}
+
+bool SoapySDR::ConverterRegistry::loadWisdom(const std::string &path)
+{
+  if (path.empty()) return false;
+  std::ifstream file(path);
+  if (not file) return false;
+
+  //parse the whole file before taking the registry lock
+  std::vector<TunedEntry> entries;
+  std::string line;
+  while (std::getline(file, line))
+    {
+      std::istringstream iss(line);
+      std::string sourceFormat, targetFormat;
+      int priority(0);
+      if (not (iss >> sourceFormat >> targetFormat >> priority))
+        {
+          if (not line.empty()) SoapySDR::logf(SOAPY_SDR_WARNING, "ConverterRegistry::loadWisdom(%s) skipping malformed line: %s", path.c_str(), line.c_str());
+          continue;
+        }
+      TunedPriority tuned;
+      tuned.priority = FunctionPriority(priority);
+      std::string candidate;
+      while (iss >> candidate) tuned.signature += (tuned.signature.empty()?"":" ") + candidate;
+      entries.push_back(std::make_pair(std::make_pair(sourceFormat, targetFormat), tuned));
+    }
+
+  //the file may come from another build, so only registered priorities are kept;
+  //this runs during the first lookup, so the pending tables are read instead of a snapshot
+  std::vector<bool> registered(entries.size());
+  {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    const auto &pending = getPendingRegistry();
+    for (size_t i = 0; i < entries.size(); i++)
+      {
+        const auto priorities = findPriorities(pending, entries[i].first.first, entries[i].first.second);
+        registered[i] = priorities != nullptr and priorities->count(entries[i].second.priority) != 0;
+      }
+  }
+  std::vector<TunedEntry> valid;
+  for (size_t i = 0; i < entries.size(); i++)
+    {
+      if (registered[i]) valid.push_back(entries[i]);
+      else SoapySDR::logf(SOAPY_SDR_WARNING, "ConverterRegistry::loadWisdom(%s) dropping unregistered priority %d for %s -> %s", path.c_str(),
+                          int(entries[i].second.priority), entries[i].first.first.c_str(), entries[i].first.second.c_str());
+    }
+
+  storeTuned(valid);
+  return true;
+}
+
+static void makeParentDirs(const std::string &path)
+{
+  for (size_t pos = path.find_first_of("/\\", 1); pos != std::string::npos; pos = path.find_first_of("/\\", pos+1))
+    {
+      const std::string dir = path.substr(0, pos);
+      #ifdef _WIN32
+      _mkdir(dir.c_str());
+      #else
+      mkdir(dir.c_str(), 0755);
+      #endif
+    }
+}
+
+bool SoapySDR::ConverterRegistry::saveWisdom(const std::string &path)
+{
+  if (path.empty()) return false;
+  const auto &snapshot = getSnapshot();
+
+  //results for conversions from modules that are not loaded are kept as is;
+  //write a temporary file and rename it into place,
+  //so that concurrent processes never load a partial file
+  makeParentDirs(path);
+  const std::string tmpPath = path + ".tmp";
+  {
+    std::ofstream file(tmpPath);
+    for (const auto &source : snapshot.tuned)
+      {
+        for (const auto &target : source.second)
+          {
+            file << source.first << " " << target.first << " " << int(target.second.priority) << " " << target.second.signature << std::endl;
+          }
+      }
+    if (not file)
+      {
+        SoapySDR::logf(SOAPY_SDR_ERROR, "ConverterRegistry::saveWisdom(%s) failed to write %s", path.c_str(), tmpPath.c_str());
+        std::remove(tmpPath.c_str());
+        return false;
+      }
+  }
+
+  #ifdef _WIN32
+  std::remove(path.c_str());
+  #endif
+  if (std::rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+      SoapySDR::logf(SOAPY_SDR_ERROR, "ConverterRegistry::saveWisdom(%s) failed to rename %s", path.c_str(), tmpPath.c_str());
+      std::remove(tmpPath.c_str());
+      return false;
+    }
+  return true;
+}
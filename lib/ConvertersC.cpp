@@ -55,6 +55,20 @@ SoapySDRConverterFunctionPriority *SoapySDRConverter_listPriorities(const char*
     __SOAPY_SDR_C_CATCH_RET(nullptr);
 }
 
+char *SoapySDRConverter_getInstructionSet(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority)
+{
+    __SOAPY_SDR_C_TRY
+    return toCString(SoapySDR::ConverterRegistry::getInstructionSet(sourceFormat, targetFormat, static_cast<SoapySDR::ConverterRegistry::FunctionPriority>(priority)));
+    __SOAPY_SDR_C_CATCH_RET(nullptr);
+}
+
+bool SoapySDRConverter_isInPlace(const char *sourceFormat, const char *targetFormat, const SoapySDRConverterFunctionPriority priority)
+{
+    __SOAPY_SDR_C_TRY
+    return SoapySDR::ConverterRegistry::isInPlace(sourceFormat, targetFormat, static_cast<SoapySDR::ConverterRegistry::FunctionPriority>(priority));
+    __SOAPY_SDR_C_CATCH_RET(false);
+}
+
 SoapySDRConverterFunction SoapySDRConverter_getFunction(const char *sourceFormat, const char *targetFormat)
 {
     __SOAPY_SDR_C_TRY
@@ -69,6 +83,13 @@ SoapySDRConverterFunction SoapySDRConverter_getFunctionWithPriority(const char *
     __SOAPY_SDR_C_CATCH_RET(nullptr);
 }
 
+int SoapySDRConverter_convertChannels(const SoapySDRConverterFunction converter, const void * const *srcBuffs, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+    __SOAPY_SDR_C_TRY
+    SoapySDR::ConverterRegistry::convertChannels(converter, srcBuffs, dstBuffs, numChans, numElems, scaler);
+    __SOAPY_SDR_C_CATCH
+}
+
 char **SoapySDRConverter_listAvailableSourceFormats(size_t *length)
 {
     *length = 0;
@@ -0,0 +1,174 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConvertingStream.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <algorithm> //min/find
+#include <cstdlib> //atoi
+#include <stdexcept>
+
+/***********************************************************************
+ * The full scale of a format's sample type: 1.0 for floating point and
+ * 2^(bits-1) for integers, which is the range the converter primitives map.
+ **********************************************************************/
+static double formatTypeFullScale(const std::string &format)
+{
+    const size_t pos = (not format.empty() and format[0] == 'C')?1:0;
+    if (pos >= format.size() or format[pos] == 'F') return 1.0;
+    const int bits = std::atoi(format.c_str()+pos+1);
+    if (bits <= 1) return 1.0;
+    return double(1ull << (bits-1));
+}
+
+/***********************************************************************
+ * ConvertingStream implementation
+ **********************************************************************/
+SoapySDR::ConvertingStream::ConvertingStream(
+    Device *device,
+    const int direction,
+    const std::string &format,
+    const std::vector<size_t> &channels,
+    const Kwargs &args):
+    _device(device),
+    _stream(nullptr),
+    _format(format),
+    _streamFormat(format),
+    _numChans(channels.empty()?1:channels.size()),
+    _mtu(0),
+    _direct(false),
+    _readBuffs(_numChans),
+    _readSrcs(_numChans),
+    _readHandle(0),
+    _readOffset(0),
+    _readElems(0),
+    _readFlags(0),
+    _readTimeNs(0),
+    _writeBuffs(_numChans)
+{
+    const size_t channel = channels.empty()?0:channels.front();
+    const auto formats = device->getStreamFormats(direction, channel);
+    double fullScale(0.0);
+    const auto nativeFormat = device->getNativeStreamFormat(direction, channel, fullScale);
+
+    //convert only when the device does not take the format itself
+    if (std::find(formats.begin(), formats.end(), format) == formats.end() and format != nativeFormat)
+    {
+        //map the native full scale onto the full scale of the requested format
+        double scaler = 1.0;
+        if (fullScale > 0.0) scaler = formatTypeFullScale(nativeFormat)/fullScale;
+        if (direction == SOAPY_SDR_RX) _converter = PreparedConverter(nativeFormat, format, scaler);
+        else _converter = PreparedConverter(format, nativeFormat, 1.0/scaler);
+        _streamFormat = nativeFormat;
+    }
+
+    _stream = device->setupStream(direction, _streamFormat, channels, args);
+    if (_stream == nullptr) throw std::runtime_error("ConvertingStream() setupStream failed for "+_streamFormat);
+    _mtu = device->getStreamMTU(_stream);
+    if (not _converter) return;
+
+    _direct = device->getNumDirectAccessBuffers(_stream) != 0;
+    if (not _direct) _scratch = BufferPool(_numChans, _mtu*SoapySDR::formatToSize(_streamFormat));
+}
+
+SoapySDR::ConvertingStream::~ConvertingStream(void)
+{
+    if (_readElems != 0) _device->releaseReadBuffer(_stream, _readHandle);
+    _device->closeStream(_stream);
+}
+
+SoapySDR::Stream *SoapySDR::ConvertingStream::getStream(void) const
+{
+    return _stream;
+}
+
+const std::string &SoapySDR::ConvertingStream::getFormat(void) const
+{
+    return _format;
+}
+
+const std::string &SoapySDR::ConvertingStream::getStreamFormat(void) const
+{
+    return _streamFormat;
+}
+
+bool SoapySDR::ConvertingStream::isConverting(void) const
+{
+    return bool(_converter);
+}
+
+size_t SoapySDR::ConvertingStream::getMTU(void) const
+{
+    return _mtu;
+}
+
+int SoapySDR::ConvertingStream::read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    if (not _converter) return _device->readStream(_stream, buffs, numElems, flags, timeNs, timeoutUs);
+    if (_direct) return this->readDirect(buffs, numElems, flags, timeNs, timeoutUs);
+
+    const int ret = _device->readStream(_stream, _scratch.getBuffers(), std::min(numElems, _mtu), flags, timeNs, timeoutUs);
+    if (ret > 0) _converter.convert(_scratch.getBuffers(), buffs, _numChans, size_t(ret));
+    return ret;
+}
+
+int SoapySDR::ConvertingStream::readDirect(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    if (_readElems == 0)
+    {
+        const int ret = _device->acquireReadBuffer(_stream, _readHandle, _readBuffs.data(), _readFlags, _readTimeNs, timeoutUs);
+        if (ret <= 0) return ret;
+        _readOffset = 0;
+        _readElems = size_t(ret);
+    }
+
+    //convert straight out of the acquired buffer
+    const size_t n = std::min(numElems, _readElems-_readOffset);
+    const size_t elemSize = _converter.getSourceElemSize();
+    for (size_t i = 0; i < _numChans; i++) _readSrcs[i] = (const char *)_readBuffs[i] + _readOffset*elemSize;
+    _converter.convert(_readSrcs.data(), buffs, _numChans, n);
+
+    flags = _readFlags;
+    timeNs = _readTimeNs;
+    if (_readOffset != 0) flags &= ~SOAPY_SDR_HAS_TIME;
+
+    _readOffset += n;
+    if (_readOffset == _readElems)
+    {
+        _readElems = 0;
+        _device->releaseReadBuffer(_stream, _readHandle);
+    }
+    else
+    {
+        flags &= ~SOAPY_SDR_END_BURST;
+        flags |= SOAPY_SDR_MORE_FRAGMENTS;
+    }
+    return int(n);
+}
+
+int SoapySDR::ConvertingStream::write(const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+{
+    if (not _converter) return _device->writeStream(_stream, buffs, numElems, flags, timeNs, timeoutUs);
+    if (_direct) return this->writeDirect(buffs, numElems, flags, timeNs, timeoutUs);
+
+    //the burst only ends with the last element, the caller's flags are left for the next call
+    const size_t n = std::min(numElems, _mtu);
+    int writeFlags = flags;
+    if (n != numElems) writeFlags &= ~SOAPY_SDR_END_BURST;
+    _converter.convert(buffs, _scratch.getBuffers(), _numChans, n);
+    return _device->writeStream(_stream, _scratch.getBuffers(), n, writeFlags, timeNs, timeoutUs);
+}
+
+int SoapySDR::ConvertingStream::writeDirect(const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
+{
+    size_t handle(0);
+    const int ret = _device->acquireWriteBuffer(_stream, handle, _writeBuffs.data(), timeoutUs);
+    if (ret <= 0) return ret;
+
+    //convert straight into the acquired buffer
+    const size_t n = std::min(numElems, size_t(ret));
+    _converter.convert(buffs, _writeBuffs.data(), _numChans, n);
+    int writeFlags = flags;
+    if (n != numElems) writeFlags &= ~SOAPY_SDR_END_BURST;
+    _device->releaseWriteBuffer(_stream, handle, n, writeFlags, timeNs);
+    return int(n);
+}
@@ -7,640 +7,629 @@
 #include <SoapySDR/ConverterPrimitives.hpp>
 #include <SoapySDR/ConverterRegistry.hpp>
 #include <SoapySDR/Formats.hpp>
+#include "ConverterHelpers.hpp"
+#include <algorithm>
+#include <cmath>
 #include <cstring> //memcpy
+#include <limits>
+#include <type_traits>
 
 // ********************************
-// Real Soapy Formats
+// Integer Scaling Helpers
+//
+// Integer to integer converters with a power of two scaler (including 1.0)
+// scale with shifts instead of a round trip through double precision.
+// Results saturate to the type and truncate toward zero like the multiply.
+
+//wide enough to hold any shifted sample of type T
+template <typename T>
+using ShiftType = typename std::conditional<(sizeof(T) < sizeof(int32_t)), int32_t, int64_t>::type;
+
+//scale an integer by 2^shift, saturating to the type
+template <typename T>
+static inline T shiftLeftScale(const T x, const int shift)
+{
+  const ShiftType<T> y = ShiftType<T>(x) * (ShiftType<T>(1) << shift);
+  return T(std::min<ShiftType<T>>(std::max<ShiftType<T>>(y, std::numeric_limits<T>::min()), std::numeric_limits<T>::max()));
+}
+
+//scale an integer by 2^-shift, truncating toward zero
+template <typename T>
+static inline T shiftRightScale(const T x, const int shift)
+{
+  const ShiftType<T> wide = x;
+  return T((wide + ((wide < 0)?((ShiftType<T>(1) << shift)-1):0)) >> shift);
+}
+
+//dst = convert(src * scaler), returns false when the scaler needs floating point
+template <typename InType, typename OutType, typename ConvertFcn>
+static inline bool scaleThenConvert(const InType *src, OutType *dst, const size_t numSamps, const double scaler, const ConvertFcn &convert)
+{
+  int shift = 0;
+  if (not scalerToShift(scaler, 8*sizeof(InType)-1, shift)) return false;
+  if (shift == 0) for (size_t i = 0; i < numSamps; i++) dst[i] = convert(src[i]);
+  else if (shift > 0) for (size_t i = 0; i < numSamps; i++) dst[i] = convert(shiftLeftScale(src[i], shift));
+  else for (size_t i = 0; i < numSamps; i++) dst[i] = convert(shiftRightScale(src[i], -shift));
+  return true;
+}
+
+//dst = convert(src) * scaler, returns false when the scaler needs floating point
+template <typename InType, typename OutType, typename ConvertFcn>
+static inline bool convertThenScale(const InType *src, OutType *dst, const size_t numSamps, const double scaler, const ConvertFcn &convert)
+{
+  int shift = 0;
+  if (not scalerToShift(scaler, 8*sizeof(OutType)-1, shift)) return false;
+  if (shift == 0) for (size_t i = 0; i < numSamps; i++) dst[i] = convert(src[i]);
+  else if (shift > 0) for (size_t i = 0; i < numSamps; i++) dst[i] = shiftLeftScale(OutType(convert(src[i])), shift);
+  else for (size_t i = 0; i < numSamps; i++) dst[i] = shiftRightScale(OutType(convert(src[i])), -shift);
+  return true;
+}
+
+//scale single integer samples like the helpers above, for the packed formats
+//that convert sample by sample: shifts for power of two scalers,
+//otherwise a multiply in double precision that saturates to the type
+template <typename T>
+class IntegerScaler
+{
+public:
+  IntegerScaler(const double scaler):
+    _scaler(scaler),
+    _shift(0),
+    _isShift(scalerToShift(scaler, 8*sizeof(T)-1, _shift))
+  {
+    return;
+  }
+
+  inline T operator()(const T x) const
+  {
+    if (not _isShift)
+      {
+        const double y = x * _scaler;
+        return T(std::min<double>(std::max<double>(y, std::numeric_limits<T>::min()), std::numeric_limits<T>::max()));
+      }
+    if (_shift == 0) return x;
+    if (_shift > 0) return shiftLeftScale(x, _shift);
+    return shiftRightScale(x, -_shift);
+  }
+
+private:
+  double _scaler;
+  int _shift;
+  bool _isShift;
+};
 
-// Copy Converters
+// ********************************
+// Kernel Framework
+//
+// The element-wise converters are instantiated from genericConvert
+// with a primitive from ConverterPrimitives.hpp and the point where
+// the scaler applies: to the input before the primitive (narrowing)
+// or to the output after the primitive (widening).
+// Each variant is a separate loop with a fixed body, so the compiler
+// can vectorize it: unit scale calls the bare primitive,
+// floating point scaling multiplies in the sample type,
+// integer scaling uses the shift helpers above,
+// and aligned buffers take a loop with alignment hints.
+// Real and complex formats differ only in the elemDepth argument.
+// Each loop reads a sample before writing the same index, so kernels
+// whose input and output types may alias (the same type, or signed
+// and unsigned variants of it) are registered as in-place.
 
-// F32 <> F32
-static void genericF32toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 1;
+#if defined(__GNUC__) || defined(__clang__)
+#define SOAPY_SDR_ASSUME_ALIGNED(p, n) __builtin_assume_aligned(p, n)
+#else
+#define SOAPY_SDR_ASSUME_ALIGNED(p, n) (p)
+#endif
 
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(float);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
-    {
-      auto *src = (float*)srcBuff;
-      auto *dst = (float*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = float(src[i]) * scaler;
-        }
-    }
-}
+static const size_t KERNEL_ALIGNMENT = 16;
 
-// S32 <> S32
-static void genericS32toS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+enum ScalePoint
 {
-  const size_t elemDepth = 1;
+  SCALE_INPUT,
+  SCALE_OUTPUT,
+};
 
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(int32_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
-    {
-      auto *src = (int32_t*)srcBuff;
-      auto *dst = (int32_t*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = int32_t(src[i]) * scaler;
-        }
-    }
-}
-
-// S16 <> S16
-static void genericS16toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename T>
+static inline T copySample(const T from)
 {
-  const size_t elemDepth = 1;
-
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(int16_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
-    {
-      auto *src = (int16_t*)srcBuff;
-      auto *dst = (int16_t*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = int16_t(src[i]) * scaler;
-        }
-    }
+  return from;
 }
 
-// S8 <> S8
-static void genericS8toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <bool Aligned, typename T>
+static inline T *alignedHint(T *p)
 {
-  const size_t elemDepth = 1;
-
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(int8_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
-    {
-      auto *src = (int8_t*)srcBuff;
-      auto *dst = (int8_t*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = int8_t(src[i]) * scaler;
-        }
-    }
+  return Aligned?(T *)SOAPY_SDR_ASSUME_ALIGNED(p, KERNEL_ALIGNMENT):p;
 }
 
-// Type Converters
-
-// F32 <> S16
-static void genericF32toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+//dst = convert(src)
+template <bool Aligned, typename InType, typename OutType, OutType (*Convert)(InType)>
+static inline void convertUnit(const InType *src, OutType *dst, const size_t numSamps)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (float*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::F32toS16(src[i] * scaler);
-    }
+  src = alignedHint<Aligned>(src);
+  dst = alignedHint<Aligned>(dst);
+  for (size_t i = 0; i < numSamps; i++) dst[i] = Convert(src[i]);
 }
 
-static void genericS16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+//dst = convert(src * scaler) in the floating point input type
+template <bool Aligned, typename InType, typename OutType, OutType (*Convert)(InType)>
+static inline void convertScaleInput(const InType *src, OutType *dst, const size_t numSamps, const InType scaler)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S16toF32(src[i]) * scaler;
-    }
+  src = alignedHint<Aligned>(src);
+  dst = alignedHint<Aligned>(dst);
+  for (size_t i = 0; i < numSamps; i++) dst[i] = Convert(src[i] * scaler);
 }
 
-// F32 <> U16
-static void genericF32toU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+//dst = convert(src) * scaler in the floating point output type
+template <bool Aligned, typename InType, typename OutType, OutType (*Convert)(InType)>
+static inline void convertScaleOutput(const InType *src, OutType *dst, const size_t numSamps, const OutType scaler)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (float*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::F32toU16(src[i] * scaler);
-    }
+  src = alignedHint<Aligned>(src);
+  dst = alignedHint<Aligned>(dst);
+  for (size_t i = 0; i < numSamps; i++) dst[i] = Convert(src[i]) * scaler;
 }
 
-static void genericU16toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename InType, typename OutType, OutType (*Convert)(InType)>
+static inline void convertScaled(const InType *src, OutType *dst, const size_t numSamps, const double scaler, const bool aligned, std::integral_constant<ScalePoint, SCALE_INPUT>, std::true_type)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::U16toF32(src[i]) * scaler;
-    }
+  if (aligned) convertScaleInput<true, InType, OutType, Convert>(src, dst, numSamps, InType(scaler));
+  else convertScaleInput<false, InType, OutType, Convert>(src, dst, numSamps, InType(scaler));
 }
 
-// F32 <> S8
-static void genericF32toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename InType, typename OutType, OutType (*Convert)(InType)>
+static inline void convertScaled(const InType *src, OutType *dst, const size_t numSamps, const double scaler, const bool aligned, std::integral_constant<ScalePoint, SCALE_OUTPUT>, std::true_type)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (float*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::F32toS8(src[i] * scaler);
-    }
+  if (aligned) convertScaleOutput<true, InType, OutType, Convert>(src, dst, numSamps, OutType(scaler));
+  else convertScaleOutput<false, InType, OutType, Convert>(src, dst, numSamps, OutType(scaler));
 }
 
-static void genericS8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename InType, typename OutType, OutType (*Convert)(InType)>
+static inline void convertScaled(const InType *src, OutType *dst, const size_t numSamps, const double scaler, const bool, std::integral_constant<ScalePoint, SCALE_INPUT>, std::false_type)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S8toF32(src[i]) * scaler;
-    }
+  if (scaleThenConvert(src, dst, numSamps, scaler, [](const InType x){return Convert(x);})) return;
+  for (size_t i = 0; i < numSamps; i++) dst[i] = Convert(InType(src[i] * scaler));
 }
 
-// F32 <> U8
-static void genericF32toU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename InType, typename OutType, OutType (*Convert)(InType)>
+static inline void convertScaled(const InType *src, OutType *dst, const size_t numSamps, const double scaler, const bool, std::integral_constant<ScalePoint, SCALE_OUTPUT>, std::false_type)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (float*)srcBuff;
-  auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::F32toU8(src[i] * scaler);
-    }
+  if (convertThenScale(src, dst, numSamps, scaler, [](const InType x){return Convert(x);})) return;
+  for (size_t i = 0; i < numSamps; i++) dst[i] = OutType(Convert(src[i]) * scaler);
 }
 
-static void genericU8toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <size_t elemDepth, ScalePoint Point, typename InType, typename OutType, OutType (*Convert)(InType)>
+static void genericConvert(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
+  auto *src = (const InType*)srcBuff;
+  auto *dst = (OutType*)dstBuff;
+  const size_t numSamps = numElems*elemDepth;
+  const bool aligned = ((size_t(srcBuff) | size_t(dstBuff)) % KERNEL_ALIGNMENT) == 0;
 
-  auto *src = (uint8_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  if (scaler == 1.0)
     {
-      dst[i] = SoapySDR::U8toF32(src[i]) * scaler;
+      if (aligned) convertUnit<true, InType, OutType, Convert>(src, dst, numSamps);
+      else convertUnit<false, InType, OutType, Convert>(src, dst, numSamps);
+      return;
     }
-}
-
-// S16 <> U16
-static void genericS16toU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 1;
 
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S16toU16(src[i] * scaler);
-    }
+  typedef typename std::conditional<Point == SCALE_INPUT, InType, OutType>::type ScaleType;
+  convertScaled<InType, OutType, Convert>(src, dst, numSamps, scaler, aligned,
+    std::integral_constant<ScalePoint, Point>(), std::is_floating_point<ScaleType>());
 }
 
-static void genericU16toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <size_t elemDepth, typename Type>
+static void genericCopy(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::U16toS16(src[i]) * scaler;
-    }
+  if (scaler != 1.0) genericConvert<elemDepth, SCALE_INPUT, Type, Type, copySample<Type>>(srcBuff, dstBuff, numElems, scaler);
+  else if (srcBuff != dstBuff) std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sizeof(Type));
 }
 
-// S16 <> S8
-static void genericS16toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 1;
+// ********************************
+// Complex Power Data Types
+//
+// Reduce each complex element to one real power, magnitude, or dB value.
+// The scaler applies to the complex amplitude before the reduction.
+// The floating point reductions run in-place over the complex input.
 
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S16toS8(src[i] * scaler);
-    }
+static inline float powerToMagnitude(const float power)
+{
+  return std::sqrt(power);
 }
 
-static void genericS8toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static inline float powerToDB(const float power)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S8toS16(src[i]) * scaler;
-    }
+  return LOG2_TO_DB * fastLog2(power);
 }
 
-// S16 <> U8
-static void genericS16toU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename InType, float (*Convert)(InType), float (*Finish)(float)>
+static void genericPower(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *src = (const InType*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const float scale = float(scaler);
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S16toU8(src[i] * scaler);
+      const float re = Convert(src[i*2+0]) * scale;
+      const float im = Convert(src[i*2+1]) * scale;
+      dst[i] = Finish(re*re + im*im);
     }
 }
 
-static void genericU8toS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 1;
+// ********************************
+// Packed Complex Data Types
 
+// CS12 <> CS16
+static void genericCS12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
   auto *src = (uint8_t*)srcBuff;
   auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  const IntegerScaler<int16_t> scale(scaler);
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U8toS16(src[i]) * scaler;
+      int16_t i16, q16;
+      SoapySDR::CS12toCS16(src+i*3, i16, q16);
+      dst[i*2+0] = scale(i16);
+      dst[i*2+1] = scale(q16);
     }
 }
 
-// U16 <> S8
-static void genericU16toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static void genericCS16toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  const IntegerScaler<int16_t> scale(scaler);
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U16toS8(src[i] * scaler);
+      SoapySDR::CS16toCS12(scale(src[i*2+0]), scale(src[i*2+1]), dst+i*3);
     }
 }
 
-static void genericS8toU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CS12 <> CF32
+static void genericCS12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S8toU16(src[i]) * scaler;
+      int16_t i16, q16;
+      SoapySDR::CS12toCS16(src+i*3, i16, q16);
+      dst[i*2+0] = SoapySDR::S16toF32(i16) * scaler;
+      dst[i*2+1] = SoapySDR::S16toF32(q16) * scaler;
     }
 }
 
-// S8 <> U8
-static void genericS8toU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static void genericCF32toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
-
-  auto *src = (int8_t*)srcBuff;
+  auto *src = (float*)srcBuff;
   auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S8toU8(src[i] * scaler);
+      SoapySDR::CS16toCS12(SoapySDR::F32toS16(src[i*2+0] * scaler), SoapySDR::F32toS16(src[i*2+1] * scaler), dst+i*3);
     }
 }
 
-static void genericU8toS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CU12 <> CS16
+static void genericCU12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 1;
-
   auto *src = (uint8_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *dst = (int16_t*)dstBuff;
+  const IntegerScaler<int16_t> scale(scaler);
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U8toS8(src[i]) * scaler;
+      int16_t i16, q16;
+      SoapySDR::CU12toCS16(src+i*3, i16, q16);
+      dst[i*2+0] = scale(i16);
+      dst[i*2+1] = scale(q16);
     }
 }
 
-// ********************************
-// Complex Data Types
-
-// Copy Converters
-
-// CF32 <> CF32
-static void genericCF32toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static void genericCS16toCU12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(float);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
+  auto *src = (int16_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  const IntegerScaler<int16_t> scale(scaler);
+  for (size_t i = 0; i < numElems; i++)
     {
-      auto *src = (float*)srcBuff;
-      auto *dst = (float*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = float(src[i]) * scaler;
-        }
+      SoapySDR::CS16toCU12(scale(src[i*2+0]), scale(src[i*2+1]), dst+i*3);
     }
 }
 
-// CS32 <> CS32
-static void genericCS32toCS32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CU12 <> CF32
+static void genericCU12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(int32_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      auto *src = (int32_t*)srcBuff;
-      auto *dst = (int32_t*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = int32_t(src[i]) * scaler;
-        }
+      int16_t i16, q16;
+      SoapySDR::CU12toCS16(src+i*3, i16, q16);
+      dst[i*2+0] = SoapySDR::S16toF32(i16) * scaler;
+      dst[i*2+1] = SoapySDR::S16toF32(q16) * scaler;
     }
 }
 
-// CS16 <> CS16
-static void genericCS16toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static void genericCF32toCU12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  if (scaler == 1.0)
-    {
-      const size_t sampleSize = sizeof(int16_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
+  auto *src = (float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      auto *src = (int16_t*)srcBuff;
-      auto *dst = (int16_t*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = int16_t(src[i]) * scaler;
-        }
+      SoapySDR::CS16toCU12(SoapySDR::F32toS16(src[i*2+0] * scaler), SoapySDR::F32toS16(src[i*2+1] * scaler), dst+i*3);
     }
 }
 
-// CS8 <> CS8
-static void genericCS8toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CS4 -> CS8
+static void genericCS4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  if (scaler == 1.0)
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  const IntegerScaler<int8_t> scale(scaler);
+  for (size_t i = 0; i < numElems; i++)
     {
-      const size_t sampleSize = sizeof(int8_t);
-      std::memcpy(dstBuff, srcBuff, numElems*elemDepth*sampleSize);
-    }
-  else
-    {
-      auto *src = (int8_t*)srcBuff;
-      auto *dst = (int8_t*)dstBuff;
-      for (size_t i = 0; i < numElems*elemDepth; i++)
-        {
-          dst[i] = int8_t(src[i]) * scaler;
-        }
+      int8_t i8, q8;
+      SoapySDR::CS4toCS8(src[i], i8, q8);
+      dst[i*2+0] = scale(i8);
+      dst[i*2+1] = scale(q8);
     }
 }
 
-// Type Converters
-
-// CF32 <> CS16
-static void genericCF32toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CS4 -> CS16
+static void genericCS4toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (float*)srcBuff;
+  auto *src = (uint8_t*)srcBuff;
   auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  const IntegerScaler<int16_t> scale(scaler);
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::F32toS16(src[i] * scaler);
+      int8_t i8, q8;
+      SoapySDR::CS4toCS8(src[i], i8, q8);
+      dst[i*2+0] = scale(SoapySDR::S8toS16(i8));
+      dst[i*2+1] = scale(SoapySDR::S8toS16(q8));
     }
 }
 
-static void genericCS16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CS4 <> CF32
+static void genericCS4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (int16_t*)srcBuff;
+  auto *src = (uint8_t*)srcBuff;
   auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S16toF32(src[i]) * scaler;
+      int8_t i8, q8;
+      SoapySDR::CS4toCS8(src[i], i8, q8);
+      dst[i*2+0] = SoapySDR::S8toF32(i8) * scaler;
+      dst[i*2+1] = SoapySDR::S8toF32(q8) * scaler;
     }
 }
 
-// CF32 <> CU16
-static void genericCF32toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static void genericCF32toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
   auto *src = (float*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *dst = (uint8_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::F32toU16(src[i] * scaler);
+      dst[i] = SoapySDR::CS8toCS4(SoapySDR::F32toS8(src[i*2+0] * scaler), SoapySDR::F32toS8(src[i*2+1] * scaler));
     }
 }
 
-static void genericCU16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CU4 -> CS8
+static void genericCU4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  const IntegerScaler<int8_t> scale(scaler);
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U16toF32(src[i]) * scaler;
+      int8_t i8, q8;
+      SoapySDR::CU4toCS8(src[i], i8, q8);
+      dst[i*2+0] = scale(i8);
+      dst[i*2+1] = scale(q8);
     }
 }
 
-// CF32 <> CS8
-static void genericCF32toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CU4 -> CS16
+static void genericCU4toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (float*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *src = (uint8_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  const IntegerScaler<int16_t> scale(scaler);
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::F32toS8(src[i] * scaler);
+      int8_t i8, q8;
+      SoapySDR::CU4toCS8(src[i], i8, q8);
+      dst[i*2+0] = scale(SoapySDR::S8toS16(i8));
+      dst[i*2+1] = scale(SoapySDR::S8toS16(q8));
     }
 }
 
-static void genericCS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CU4 <> CF32
+static void genericCU4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
-  auto *src = (int8_t*)srcBuff;
+  auto *src = (uint8_t*)srcBuff;
   auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S8toF32(src[i]) * scaler;
+      int8_t i8, q8;
+      SoapySDR::CU4toCS8(src[i], i8, q8);
+      dst[i*2+0] = SoapySDR::S8toF32(i8) * scaler;
+      dst[i*2+1] = SoapySDR::S8toF32(q8) * scaler;
     }
 }
 
-// CF32 <> CU8
-static void genericCF32toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+static void genericCF32toCU4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
 {
-  const size_t elemDepth = 2;
-
   auto *src = (float*)srcBuff;
   auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::F32toU8(src[i] * scaler);
+      dst[i] = SoapySDR::CS8toCU4(SoapySDR::F32toS8(src[i*2+0] * scaler), SoapySDR::F32toS8(src[i*2+1] * scaler));
     }
 }
 
-static void genericCU8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 2;
-
-  auto *src = (uint8_t*)srcBuff;
-  auto *dst = (float*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::U8toF32(src[i]) * scaler;
-    }
-}
+// ********************************
+// Channel Layout Converters
 
-// CS16 <> CU16
-static void genericCS16toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CS16 -> CS16 (deinterleave)
+static void genericDeinterleaveCS16toCS16(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
 {
   const size_t elemDepth = 2;
+  const IntegerScaler<int16_t> scale(scaler);
 
   auto *src = (int16_t*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S16toU16(src[i] * scaler);
-    }
-}
-
-static void genericCU16toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 2;
-
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U16toS16(src[i]) * scaler;
+      for (size_t ch = 0; ch < numChans; ch++)
+        {
+          auto *dst = (int16_t*)dstBuffs[ch];
+          for (size_t j = 0; j < elemDepth; j++)
+            {
+              dst[i*elemDepth+j] = scale(src[(i*numChans+ch)*elemDepth+j]);
+            }
+        }
     }
 }
 
-// CS16 <> CS8
-static void genericCS16toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CS16 -> CF32 (deinterleave)
+static void genericDeinterleaveCS16toCF32(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
 {
   const size_t elemDepth = 2;
 
   auto *src = (int16_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S16toS8(src[i] * scaler);
+      for (size_t ch = 0; ch < numChans; ch++)
+        {
+          auto *dst = (float*)dstBuffs[ch];
+          for (size_t j = 0; j < elemDepth; j++)
+            {
+              dst[i*elemDepth+j] = SoapySDR::S16toF32(src[(i*numChans+ch)*elemDepth+j]) * scaler;
+            }
+        }
     }
 }
 
-static void genericCS8toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CF32 -> CF32 (deinterleave)
+static void genericDeinterleaveCF32toCF32(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
 {
   const size_t elemDepth = 2;
 
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *src = (float*)srcBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S8toS16(src[i]) * scaler;
+      for (size_t ch = 0; ch < numChans; ch++)
+        {
+          auto *dst = (float*)dstBuffs[ch];
+          for (size_t j = 0; j < elemDepth; j++)
+            {
+              dst[i*elemDepth+j] = src[(i*numChans+ch)*elemDepth+j] * scaler;
+            }
+        }
     }
 }
 
-// CS16 <> CU8
-static void genericCS16toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CS16 -> CS16 (interleave)
+static void genericInterleaveCS16toCS16(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
 {
   const size_t elemDepth = 2;
+  const IntegerScaler<int16_t> scale(scaler);
 
-  auto *src = (int16_t*)srcBuff;
-  auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *dst = (int16_t*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S16toU8(src[i] * scaler);
+      for (size_t ch = 0; ch < numChans; ch++)
+        {
+          auto *src = (int16_t*)srcBuffs[ch];
+          for (size_t j = 0; j < elemDepth; j++)
+            {
+              dst[(i*numChans+ch)*elemDepth+j] = scale(src[i*elemDepth+j]);
+            }
+        }
     }
 }
 
-static void genericCU8toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CF32 -> CS16 (interleave)
+static void genericInterleaveCF32toCS16(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
 {
   const size_t elemDepth = 2;
 
-  auto *src = (uint8_t*)srcBuff;
   auto *dst = (int16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U8toS16(src[i]) * scaler;
+      for (size_t ch = 0; ch < numChans; ch++)
+        {
+          auto *src = (float*)srcBuffs[ch];
+          for (size_t j = 0; j < elemDepth; j++)
+            {
+              dst[(i*numChans+ch)*elemDepth+j] = SoapySDR::F32toS16(src[i*elemDepth+j] * scaler);
+            }
+        }
     }
 }
 
-// CU16 <> CS8
-static void genericCU16toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+// CF32 -> CF32 (interleave)
+static void genericInterleaveCF32toCF32(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
 {
   const size_t elemDepth = 2;
 
-  auto *src = (uint16_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  auto *dst = (float*)dstBuff;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::U16toS8(src[i] * scaler);
+      for (size_t ch = 0; ch < numChans; ch++)
+        {
+          auto *src = (float*)srcBuffs[ch];
+          for (size_t j = 0; j < elemDepth; j++)
+            {
+              dst[(i*numChans+ch)*elemDepth+j] = src[i*elemDepth+j] * scaler;
+            }
+        }
     }
 }
 
-static void genericCS8toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 2;
-
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (uint16_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::S8toU16(src[i]) * scaler;
-    }
-}
+// ********************************
+// Decimating Converters
+//
+// Convert and decimate complex samples by an integer factor in one pass
+// with a CIC filter: the integrators run at the input rate and the combs
+// and the output conversion run once per factor input elements.
+// The filter runs in unsigned 64 bit arithmetic, which wraps around
+// exactly as long as the comb output fits, see DECIMATE_MAX_FACTOR.
 
-// CS8 <> CU8
-static void genericCS8toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+template <typename InType, typename SampType, SampType (*ToSample)(InType), typename OutType, OutType (*FromFloat)(float)>
+static size_t genericDecimate(const void *srcBuff, void *dstBuff, const size_t numElems, const size_t factor, SoapySDR::ConverterRegistry::DecimateState &state, const double scaler)
 {
-  const size_t elemDepth = 2;
+  const size_t order = SoapySDR::ConverterRegistry::DECIMATE_ORDER;
+  auto *src = (const InType*)srcBuff;
+  auto *dst = (OutType*)dstBuff;
+  const double norm = decimateNorm(factor, order, 8*sizeof(SampType)-1, scaler);
 
-  auto *src = (int8_t*)srcBuff;
-  auto *dst = (uint8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
+  size_t numOut = 0;
+  for (size_t i = 0; i < numElems; i++)
     {
-      dst[i] = SoapySDR::S8toU8(src[i] * scaler);
-    }
-}
-
-static void genericCU8toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
-{
-  const size_t elemDepth = 2;
+      for (size_t ch = 0; ch < 2; ch++)
+        {
+          uint64_t x = uint64_t(int64_t(ToSample(src[i*2+ch])));
+          for (size_t k = 0; k < order; k++) x = state.integrators[k*2+ch] += x;
+        }
+      if (++state.phase < factor) continue;
+      state.phase = 0;
 
-  auto *src = (uint8_t*)srcBuff;
-  auto *dst = (int8_t*)dstBuff;
-  for (size_t i = 0; i < numElems*elemDepth; i++)
-    {
-      dst[i] = SoapySDR::U8toS8(src[i]) * scaler;
+      for (size_t ch = 0; ch < 2; ch++)
+        {
+          uint64_t x = state.integrators[(order-1)*2+ch];
+          for (size_t k = 0; k < order; k++)
+            {
+              const uint64_t y = x - state.combs[k*2+ch];
+              state.combs[k*2+ch] = x;
+              x = y;
+            }
+          dst[numOut*2+ch] = FromFloat(float(double(int64_t(x))*norm));
+        }
+      numOut++;
     }
+  return numOut;
 }
 
+void lateLoadVectorizedConverters(void);
+
 /*!
  * lateLoadDefaultConverters() is called by loadModules()
  * to load the converters on-demand/not statically.
@@ -651,48 +640,99 @@ static void genericCU8toCS8(const void *srcBuff, void *dstBuff, const size_t num
  */
 void lateLoadDefaultConverters(void)
 {
-    static SoapySDR::ConverterRegistry registerGenericF32toF32(SOAPY_SDR_F32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericF32toF32);
-    static SoapySDR::ConverterRegistry registerGenericS32toS32(SOAPY_SDR_S32, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::GENERIC, &genericS32toS32);
-    static SoapySDR::ConverterRegistry registerGenericS16toS16(SOAPY_SDR_S16, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericS16toS16);
-    static SoapySDR::ConverterRegistry registerGenericS8toS8(SOAPY_SDR_S8, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericS8toS8);
-    static SoapySDR::ConverterRegistry registerGenericF32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericF32toS16);
-    static SoapySDR::ConverterRegistry registerGenericS16toF32(SOAPY_SDR_S16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericS16toF32);
-    static SoapySDR::ConverterRegistry registerGenericF32toU16(SOAPY_SDR_F32, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::GENERIC, &genericF32toU16);
-    static SoapySDR::ConverterRegistry registerGenericU16toF32(SOAPY_SDR_U16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericU16toF32);
-    static SoapySDR::ConverterRegistry registerGenericF32toS8(SOAPY_SDR_F32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericF32toS8);
-    static SoapySDR::ConverterRegistry registerGenericS8toF32(SOAPY_SDR_S8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericS8toF32);
-    static SoapySDR::ConverterRegistry registerGenericF32toU8(SOAPY_SDR_F32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericF32toU8);
-    static SoapySDR::ConverterRegistry registerGenericU8toF32(SOAPY_SDR_U8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericU8toF32);
-    static SoapySDR::ConverterRegistry registerGenericS16toU16(SOAPY_SDR_S16, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::GENERIC, &genericS16toU16);
-    static SoapySDR::ConverterRegistry registerGenericU16toS16(SOAPY_SDR_U16, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericU16toS16);
-    static SoapySDR::ConverterRegistry registerGenericS16toS8(SOAPY_SDR_S16, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericS16toS8);
-    static SoapySDR::ConverterRegistry registerGenericS8toS16(SOAPY_SDR_S8, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericS8toS16);
-    static SoapySDR::ConverterRegistry registerGenericS16toU8(SOAPY_SDR_S16, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericS16toU8);
-    static SoapySDR::ConverterRegistry registerGenericU8toS16(SOAPY_SDR_U8, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericU8toS16);
-    static SoapySDR::ConverterRegistry registerGenericU16toS8(SOAPY_SDR_U16, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericU16toS8);
-    static SoapySDR::ConverterRegistry registerGenericS8toU16(SOAPY_SDR_S8, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::GENERIC, &genericS8toU16);
-    static SoapySDR::ConverterRegistry registerGenericS8toU8(SOAPY_SDR_S8, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericS8toU8);
-    static SoapySDR::ConverterRegistry registerGenericU8toS8(SOAPY_SDR_U8, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericU8toS8);
-    static SoapySDR::ConverterRegistry registerGenericCF32toCF32(SOAPY_SDR_CF32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCF32);
-    static SoapySDR::ConverterRegistry registerGenericCS32toCS32(SOAPY_SDR_CS32, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericCS32toCS32);
-    static SoapySDR::ConverterRegistry registerGenericCS16toCS16(SOAPY_SDR_CS16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCS16);
-    static SoapySDR::ConverterRegistry registerGenericCS8toCS8(SOAPY_SDR_CS8, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCS8);
-    static SoapySDR::ConverterRegistry registerGenericCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS16);
-    static SoapySDR::ConverterRegistry registerGenericCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCF32);
-    static SoapySDR::ConverterRegistry registerGenericCF32toCU16(SOAPY_SDR_CF32, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCU16);
-    static SoapySDR::ConverterRegistry registerGenericCU16toCF32(SOAPY_SDR_CU16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCU16toCF32);
-    static SoapySDR::ConverterRegistry registerGenericCF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS8);
-    static SoapySDR::ConverterRegistry registerGenericCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCF32);
-    static SoapySDR::ConverterRegistry registerGenericCF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCU8);
-    static SoapySDR::ConverterRegistry registerGenericCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCU8toCF32);
-    static SoapySDR::ConverterRegistry registerGenericCS16toCU16(SOAPY_SDR_CS16, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCU16);
-    static SoapySDR::ConverterRegistry registerGenericCU16toCS16(SOAPY_SDR_CU16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCU16toCS16);
-    static SoapySDR::ConverterRegistry registerGenericCS16toCS8(SOAPY_SDR_CS16, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCS8);
-    static SoapySDR::ConverterRegistry registerGenericCS8toCS16(SOAPY_SDR_CS8, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCS16);
-    static SoapySDR::ConverterRegistry registerGenericCS16toCU8(SOAPY_SDR_CS16, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCU8);
-    static SoapySDR::ConverterRegistry registerGenericCU8toCS16(SOAPY_SDR_CU8, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCU8toCS16);
-    static SoapySDR::ConverterRegistry registerGenericCU16toCS8(SOAPY_SDR_CU16, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCU16toCS8);
-    static SoapySDR::ConverterRegistry registerGenericCS8toCU16(SOAPY_SDR_CS8, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCU16);
-    static SoapySDR::ConverterRegistry registerGenericCS8toCU8(SOAPY_SDR_CS8, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericCS8toCU8);
-    static SoapySDR::ConverterRegistry registerGenericCU8toCS8(SOAPY_SDR_CU8, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCU8toCS8);
+    static SoapySDR::ConverterRegistry registerGenericF32toF32(SOAPY_SDR_F32, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericCopy<1, float>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericS32toS32(SOAPY_SDR_S32, SOAPY_SDR_S32, SoapySDR::ConverterRegistry::GENERIC, &genericCopy<1, int32_t>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericS16toS16(SOAPY_SDR_S16, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericCopy<1, int16_t>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericS8toS8(SOAPY_SDR_S8, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericCopy<1, int8_t>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericF32toS16(SOAPY_SDR_F32, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_INPUT, float, int16_t, SoapySDR::F32toS16>);
+    static SoapySDR::ConverterRegistry registerGenericS16toF32(SOAPY_SDR_S16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_OUTPUT, int16_t, float, SoapySDR::S16toF32>);
+    static SoapySDR::ConverterRegistry registerGenericF32toU16(SOAPY_SDR_F32, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_INPUT, float, uint16_t, SoapySDR::F32toU16>);
+    static SoapySDR::ConverterRegistry registerGenericU16toF32(SOAPY_SDR_U16, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_OUTPUT, uint16_t, float, SoapySDR::U16toF32>);
+    static SoapySDR::ConverterRegistry registerGenericF32toS8(SOAPY_SDR_F32, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_INPUT, float, int8_t, SoapySDR::F32toS8>);
+    static SoapySDR::ConverterRegistry registerGenericS8toF32(SOAPY_SDR_S8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_OUTPUT, int8_t, float, SoapySDR::S8toF32>);
+    static SoapySDR::ConverterRegistry registerGenericF32toU8(SOAPY_SDR_F32, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_INPUT, float, uint8_t, SoapySDR::F32toU8>);
+    static SoapySDR::ConverterRegistry registerGenericU8toF32(SOAPY_SDR_U8, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_OUTPUT, uint8_t, float, SoapySDR::U8toF32>);
+    static SoapySDR::ConverterRegistry registerGenericS16toU16(SOAPY_SDR_S16, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_INPUT, int16_t, uint16_t, SoapySDR::S16toU16>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericU16toS16(SOAPY_SDR_U16, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_OUTPUT, uint16_t, int16_t, SoapySDR::U16toS16>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericS16toS8(SOAPY_SDR_S16, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_INPUT, int16_t, int8_t, SoapySDR::S16toS8>);
+    static SoapySDR::ConverterRegistry registerGenericS8toS16(SOAPY_SDR_S8, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_OUTPUT, int8_t, int16_t, SoapySDR::S8toS16>);
+    static SoapySDR::ConverterRegistry registerGenericS16toU8(SOAPY_SDR_S16, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_INPUT, int16_t, uint8_t, SoapySDR::S16toU8>);
+    static SoapySDR::ConverterRegistry registerGenericU8toS16(SOAPY_SDR_U8, SOAPY_SDR_S16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_OUTPUT, uint8_t, int16_t, SoapySDR::U8toS16>);
+    static SoapySDR::ConverterRegistry registerGenericU16toS8(SOAPY_SDR_U16, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_INPUT, uint16_t, int8_t, SoapySDR::U16toS8>);
+    static SoapySDR::ConverterRegistry registerGenericS8toU16(SOAPY_SDR_S8, SOAPY_SDR_U16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_OUTPUT, int8_t, uint16_t, SoapySDR::S8toU16>);
+    static SoapySDR::ConverterRegistry registerGenericS8toU8(SOAPY_SDR_S8, SOAPY_SDR_U8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_INPUT, int8_t, uint8_t, SoapySDR::S8toU8>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericU8toS8(SOAPY_SDR_U8, SOAPY_SDR_S8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_OUTPUT, uint8_t, int8_t, SoapySDR::U8toS8>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCF32(SOAPY_SDR_CF32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCopy<2, float>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCS32toCS32(SOAPY_SDR_CS32, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericCopy<2, int32_t>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCS16(SOAPY_SDR_CS16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCopy<2, int16_t>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCS8(SOAPY_SDR_CS8, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCopy<2, int8_t>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, float, int16_t, SoapySDR::F32toS16>);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, int16_t, float, SoapySDR::S16toF32>);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCU16(SOAPY_SDR_CF32, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, float, uint16_t, SoapySDR::F32toU16>);
+    static SoapySDR::ConverterRegistry registerGenericCU16toCF32(SOAPY_SDR_CU16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, uint16_t, float, SoapySDR::U16toF32>);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS8(SOAPY_SDR_CF32, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, float, int8_t, SoapySDR::F32toS8>);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, int8_t, float, SoapySDR::S8toF32>);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCU8(SOAPY_SDR_CF32, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, float, uint8_t, SoapySDR::F32toU8>);
+    static SoapySDR::ConverterRegistry registerGenericCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, uint8_t, float, SoapySDR::U8toF32>);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCU16(SOAPY_SDR_CS16, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, int16_t, uint16_t, SoapySDR::S16toU16>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCU16toCS16(SOAPY_SDR_CU16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, uint16_t, int16_t, SoapySDR::U16toS16>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCS8(SOAPY_SDR_CS16, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, int16_t, int8_t, SoapySDR::S16toS8>);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCS16(SOAPY_SDR_CS8, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, int8_t, int16_t, SoapySDR::S8toS16>);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCU8(SOAPY_SDR_CS16, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, int16_t, uint8_t, SoapySDR::S16toU8>);
+    static SoapySDR::ConverterRegistry registerGenericCU8toCS16(SOAPY_SDR_CU8, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, uint8_t, int16_t, SoapySDR::U8toS16>);
+    static SoapySDR::ConverterRegistry registerGenericCU16toCS8(SOAPY_SDR_CU16, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, uint16_t, int8_t, SoapySDR::U16toS8>);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCU16(SOAPY_SDR_CS8, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, int8_t, uint16_t, SoapySDR::S8toU16>);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCU8(SOAPY_SDR_CS8, SOAPY_SDR_CU8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, int8_t, uint8_t, SoapySDR::S8toU8>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCU8toCS8(SOAPY_SDR_CU8, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, uint8_t, int8_t, SoapySDR::U8toS8>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCS16BEtoCS16(SOAPY_SDR_CS16BE, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, int16_t, int16_t, SoapySDR::S16BEtoS16>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCS16BE(SOAPY_SDR_CS16, SOAPY_SDR_CS16BE, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, int16_t, int16_t, SoapySDR::S16toS16BE>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCS16BEtoCF32(SOAPY_SDR_CS16BE, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, int16_t, float, SoapySDR::S16BEtoF32>);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS16BE(SOAPY_SDR_CF32, SOAPY_SDR_CS16BE, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, float, int16_t, SoapySDR::F32toS16BE>);
+    static SoapySDR::ConverterRegistry registerGenericCS32BEtoCS32(SOAPY_SDR_CS32BE, SOAPY_SDR_CS32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, int32_t, int32_t, SoapySDR::S32BEtoS32>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCS32toCS32BE(SOAPY_SDR_CS32, SOAPY_SDR_CS32BE, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, int32_t, int32_t, SoapySDR::S32toS32BE>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCS32BEtoCF32(SOAPY_SDR_CS32BE, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, int32_t, float, SoapySDR::S32BEtoF32>);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS32BE(SOAPY_SDR_CF32, SOAPY_SDR_CS32BE, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, float, int32_t, SoapySDR::F32toS32BE>);
+    static SoapySDR::ConverterRegistry registerGenericCS12toCS16(SOAPY_SDR_CS12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS12toCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCS12(SOAPY_SDR_CS16, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCS12);
+    static SoapySDR::ConverterRegistry registerGenericCS12toCF32(SOAPY_SDR_CS12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS12toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS12(SOAPY_SDR_CF32, SOAPY_SDR_CS12, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS12);
+    static SoapySDR::ConverterRegistry registerGenericCU12toCS16(SOAPY_SDR_CU12, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCU12toCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCU12(SOAPY_SDR_CS16, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::GENERIC, &genericCS16toCU12);
+    static SoapySDR::ConverterRegistry registerGenericCU12toCF32(SOAPY_SDR_CU12, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCU12toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCU12(SOAPY_SDR_CF32, SOAPY_SDR_CU12, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCU12);
+    static SoapySDR::ConverterRegistry registerGenericCS4toCS8(SOAPY_SDR_CS4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCS4toCS8);
+    static SoapySDR::ConverterRegistry registerGenericCS4toCS16(SOAPY_SDR_CS4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCS4toCS16);
+    static SoapySDR::ConverterRegistry registerGenericCS4toCF32(SOAPY_SDR_CS4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCS4toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCS4(SOAPY_SDR_CF32, SOAPY_SDR_CS4, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCS4);
+    static SoapySDR::ConverterRegistry registerGenericCU4toCS8(SOAPY_SDR_CU4, SOAPY_SDR_CS8, SoapySDR::ConverterRegistry::GENERIC, &genericCU4toCS8);
+    static SoapySDR::ConverterRegistry registerGenericCU4toCS16(SOAPY_SDR_CU4, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericCU4toCS16);
+    static SoapySDR::ConverterRegistry registerGenericCU4toCF32(SOAPY_SDR_CU4, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericCU4toCF32);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCU4(SOAPY_SDR_CF32, SOAPY_SDR_CU4, SoapySDR::ConverterRegistry::GENERIC, &genericCF32toCU4);
+    static SoapySDR::ConverterRegistry registerGenericF32toF64(SOAPY_SDR_F32, SOAPY_SDR_F64, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_OUTPUT, float, double, SoapySDR::F32toF64>);
+    static SoapySDR::ConverterRegistry registerGenericF64toF32(SOAPY_SDR_F64, SOAPY_SDR_F32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<1, SCALE_INPUT, double, float, SoapySDR::F64toF32>);
+    static SoapySDR::ConverterRegistry registerGenericCF32toCF64(SOAPY_SDR_CF32, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, float, double, SoapySDR::F32toF64>);
+    static SoapySDR::ConverterRegistry registerGenericCF64toCF32(SOAPY_SDR_CF64, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_INPUT, double, float, SoapySDR::F64toF32>);
+    static SoapySDR::ConverterRegistry registerGenericCS16toCF64(SOAPY_SDR_CS16, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, int16_t, double, SoapySDR::S16toF64>);
+    static SoapySDR::ConverterRegistry registerGenericCS8toCF64(SOAPY_SDR_CS8, SOAPY_SDR_CF64, SoapySDR::ConverterRegistry::GENERIC, &genericConvert<2, SCALE_OUTPUT, int8_t, double, SoapySDR::S8toF64>);
+    static SoapySDR::ConverterRegistry registerGenericCF32toF32POW(SOAPY_SDR_CF32, SOAPY_SDR_F32POW, SoapySDR::ConverterRegistry::GENERIC, &genericPower<float, copySample<float>, copySample<float>>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCF32toF32MAG(SOAPY_SDR_CF32, SOAPY_SDR_F32MAG, SoapySDR::ConverterRegistry::GENERIC, &genericPower<float, copySample<float>, powerToMagnitude>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCF32toF32DB(SOAPY_SDR_CF32, SOAPY_SDR_F32DB, SoapySDR::ConverterRegistry::GENERIC, &genericPower<float, copySample<float>, powerToDB>, "", true);
+    static SoapySDR::ConverterRegistry registerGenericCS16toF32POW(SOAPY_SDR_CS16, SOAPY_SDR_F32POW, SoapySDR::ConverterRegistry::GENERIC, &genericPower<int16_t, SoapySDR::S16toF32, copySample<float>>);
+    static SoapySDR::ConverterRegistry registerGenericCS16toF32MAG(SOAPY_SDR_CS16, SOAPY_SDR_F32MAG, SoapySDR::ConverterRegistry::GENERIC, &genericPower<int16_t, SoapySDR::S16toF32, powerToMagnitude>);
+    static SoapySDR::ConverterRegistry registerGenericCS16toF32DB(SOAPY_SDR_CS16, SOAPY_SDR_F32DB, SoapySDR::ConverterRegistry::GENERIC, &genericPower<int16_t, SoapySDR::S16toF32, powerToDB>);
+    static SoapySDR::ConverterRegistry registerGenericCS8toF32POW(SOAPY_SDR_CS8, SOAPY_SDR_F32POW, SoapySDR::ConverterRegistry::GENERIC, &genericPower<int8_t, SoapySDR::S8toF32, copySample<float>>);
+    static SoapySDR::ConverterRegistry registerGenericCS8toF32MAG(SOAPY_SDR_CS8, SOAPY_SDR_F32MAG, SoapySDR::ConverterRegistry::GENERIC, &genericPower<int8_t, SoapySDR::S8toF32, powerToMagnitude>);
+    static SoapySDR::ConverterRegistry registerGenericCS8toF32DB(SOAPY_SDR_CS8, SOAPY_SDR_F32DB, SoapySDR::ConverterRegistry::GENERIC, &genericPower<int8_t, SoapySDR::S8toF32, powerToDB>);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveCS16toCS16(SOAPY_SDR_CS16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleaveCS16toCS16);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleaveCS16toCF32);
+    static SoapySDR::ConverterRegistry registerGenericDeinterleaveCF32toCF32(SOAPY_SDR_CF32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericDeinterleaveCF32toCF32);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveCS16toCS16(SOAPY_SDR_CS16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericInterleaveCS16toCS16);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveCF32toCS16(SOAPY_SDR_CF32, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericInterleaveCF32toCS16);
+    static SoapySDR::ConverterRegistry registerGenericInterleaveCF32toCF32(SOAPY_SDR_CF32, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericInterleaveCF32toCF32);
+    static SoapySDR::ConverterRegistry registerGenericDecimateCS16toCF32(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericDecimate<int16_t, int16_t, copySample<int16_t>, float, copySample<float>>);
+    static SoapySDR::ConverterRegistry registerGenericDecimateCS16toCS16(SOAPY_SDR_CS16, SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &genericDecimate<int16_t, int16_t, copySample<int16_t>, int16_t, SoapySDR::F32toS16>);
+    static SoapySDR::ConverterRegistry registerGenericDecimateCS8toCF32(SOAPY_SDR_CS8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericDecimate<int8_t, int8_t, copySample<int8_t>, float, copySample<float>>);
+    static SoapySDR::ConverterRegistry registerGenericDecimateCU8toCF32(SOAPY_SDR_CU8, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &genericDecimate<uint8_t, int8_t, SoapySDR::U8toS8, float, copySample<float>>);
+
+    lateLoadVectorizedConverters();
 }
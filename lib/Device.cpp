@@ -5,12 +5,152 @@
 
 #include <SoapySDR/Device.hpp>
 #include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Buffers.hpp>
+#include <SoapySDR/Errors.hpp>
+#include <SoapySDR/Logger.hpp>
 #include <cstdlib>
+#include <cstring> //memcpy
 #include <algorithm> //min/max/find
+#include <stdexcept>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <map>
+
+/*******************************************************************
+ * Default stream state
+ *
+ * The default readStream() and writeStream() forward to the direct
+ * buffer access API and the default acquire and release calls forward
+ * to readStream() and writeStream(). The state lives outside of the
+ * Device class so that the class layout of drivers is unchanged.
+ ******************************************************************/
+struct DefaultStreamState
+{
+    size_t elemSize;
+    size_t numChans;
+
+    //an acquired receive buffer that was not completely read
+    std::vector<const void *> readBuffs;
+    size_t readHandle, readOffset, readElems;
+    int readFlags;
+    long long readTimeNs;
+
+    //pointers into acquired transmit buffers
+    std::vector<void *> writeBuffs;
+    std::vector<const void *> writeSrcs;
+
+    //one MTU for the acquire calls, allocated on first use
+    SoapySDR::BufferPool buffs;
+};
+
+typedef std::map<SoapySDR::Stream *, std::shared_ptr<DefaultStreamState>> DefaultStreamMap;
+
+//never destroyed, so devices can be destroyed during static destruction
+static std::mutex &getDefaultStreamsMutex(void)
+{
+    static std::mutex *mutex = new std::mutex();
+    return *mutex;
+}
+
+static std::map<const SoapySDR::Device *, DefaultStreamMap> &getDefaultStreams(void)
+{
+    static auto *streams = new std::map<const SoapySDR::Device *, DefaultStreamMap>();
+    return *streams;
+}
+
+//bumped under the lock by every change to the table,
+//so a cached lookup is checked without taking the lock
+static std::atomic<size_t> defaultStreamsVersion(1);
+
+//the last lookup of each thread, which is the stream of every call on the hot path;
+//the state is weak so closing the stream frees its buffers while threads still cache it
+struct DefaultStreamCache
+{
+    size_t version;
+    const SoapySDR::Device *device;
+    SoapySDR::Stream *stream;
+    std::weak_ptr<DefaultStreamState> state;
+};
+
+static thread_local DefaultStreamCache defaultStreamCache = {0, nullptr, nullptr, std::weak_ptr<DefaultStreamState>()};
+
+//the state is shared, so a concurrent closeDefaultStream() does not free it during a call
+static std::shared_ptr<DefaultStreamState> getDefaultStream(const SoapySDR::Device *device, SoapySDR::Stream *stream)
+{
+    auto &cache = defaultStreamCache;
+    const size_t version = defaultStreamsVersion.load(std::memory_order_acquire);
+    if (cache.version == version and cache.device == device and cache.stream == stream) return cache.state.lock();
+
+    std::shared_ptr<DefaultStreamState> state;
+    {
+        std::lock_guard<std::mutex> lock(getDefaultStreamsMutex());
+        const auto &streams = getDefaultStreams();
+        const auto it = streams.find(device);
+        if (it != streams.end())
+        {
+            const auto it2 = it->second.find(stream);
+            if (it2 != it->second.end()) state = it2->second;
+        }
+    }
+
+    //a change after the version was loaded only causes another lookup
+    cache.version = version;
+    cache.device = device;
+    cache.stream = stream;
+    cache.state = state;
+    return state;
+}
+
+//held while a default implementation calls the other API of its stream,
+//so a device that implements neither API does not recurse;
+//the guards of a thread form a stack, so a wrapper driver can still
+//call into the defaults of another device or stream
+struct DefaultStreamGuard
+{
+    DefaultStreamGuard(const SoapySDR::Device *device, SoapySDR::Stream *stream);
+    ~DefaultStreamGuard(void);
+    static bool active(const SoapySDR::Device *device, SoapySDR::Stream *stream);
+
+    const SoapySDR::Device *device;
+    SoapySDR::Stream *stream;
+    DefaultStreamGuard *prev;
+};
+
+static thread_local DefaultStreamGuard *defaultStreamGuards = nullptr;
+
+DefaultStreamGuard::DefaultStreamGuard(const SoapySDR::Device *device, SoapySDR::Stream *stream):
+    device(device),
+    stream(stream),
+    prev(defaultStreamGuards)
+{
+    defaultStreamGuards = this;
+}
+
+DefaultStreamGuard::~DefaultStreamGuard(void)
+{
+    defaultStreamGuards = prev;
+}
+
+bool DefaultStreamGuard::active(const SoapySDR::Device *device, SoapySDR::Stream *stream)
+{
+    for (auto guard = defaultStreamGuards; guard != nullptr; guard = guard->prev)
+    {
+        if (guard->device == device and guard->stream == stream) return true;
+    }
+    return false;
+}
+
+static void allocateDefaultBuffers(const SoapySDR::Device *device, SoapySDR::Stream *stream, DefaultStreamState &state)
+{
+    if (state.buffs.getNumBuffers() != 0) return;
+    state.buffs = SoapySDR::BufferPool(state.numChans, device->getStreamMTU(stream)*state.elemSize);
+}
 
 SoapySDR::Device::~Device(void)
 {
-    return;
+    std::lock_guard<std::mutex> lock(getDefaultStreamsMutex());
+    if (getDefaultStreams().erase(this) != 0) defaultStreamsVersion++;
 }
 
 /*******************************************************************
@@ -108,14 +248,65 @@ int SoapySDR::Device::deactivateStream(Stream *, const int flags, const long lon
     return (flags == 0)? 0 : SOAPY_SDR_NOT_SUPPORTED;
 }
 
-int SoapySDR::Device::readStream(Stream *, void * const *, const size_t, int &, long long &, const long)
+int SoapySDR::Device::readStream(Stream *stream, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
 {
-    return SOAPY_SDR_NOT_SUPPORTED;
+    auto state = getDefaultStream(this, stream);
+    if (state == nullptr or DefaultStreamGuard::active(this, stream)) return SOAPY_SDR_NOT_SUPPORTED;
+
+    if (state->readElems == 0)
+    {
+        DefaultStreamGuard guard(this, stream);
+        const int ret = this->acquireReadBuffer(stream, state->readHandle, state->readBuffs.data(), state->readFlags, state->readTimeNs, timeoutUs);
+        if (ret <= 0) return ret;
+        state->readOffset = 0;
+        state->readElems = size_t(ret);
+    }
+
+    //copy out of the acquired buffer, keeping the rest for the next call
+    const size_t n = std::min(numElems, state->readElems-state->readOffset);
+    for (size_t i = 0; i < state->numChans; i++)
+    {
+        std::memcpy(buffs[i], (const char *)state->readBuffs[i] + state->readOffset*state->elemSize, n*state->elemSize);
+    }
+    flags = state->readFlags;
+    timeNs = state->readTimeNs;
+    if (state->readOffset != 0) flags &= ~SOAPY_SDR_HAS_TIME;
+
+    state->readOffset += n;
+    if (state->readOffset == state->readElems)
+    {
+        state->readElems = 0;
+        DefaultStreamGuard guard(this, stream);
+        this->releaseReadBuffer(stream, state->readHandle);
+    }
+    else
+    {
+        flags &= ~SOAPY_SDR_END_BURST;
+        flags |= SOAPY_SDR_MORE_FRAGMENTS;
+    }
+    return int(n);
 }
 
-int SoapySDR::Device::writeStream(Stream *, const void * const *, const size_t, int &, const long long, const long)
+int SoapySDR::Device::writeStream(Stream *stream, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long timeoutUs)
 {
-    return SOAPY_SDR_NOT_SUPPORTED;
+    auto state = getDefaultStream(this, stream);
+    if (state == nullptr or DefaultStreamGuard::active(this, stream)) return SOAPY_SDR_NOT_SUPPORTED;
+
+    DefaultStreamGuard guard(this, stream);
+    size_t handle(0);
+    const int ret = this->acquireWriteBuffer(stream, handle, state->writeBuffs.data(), timeoutUs);
+    if (ret <= 0) return ret;
+
+    //the burst only ends with the last element
+    const size_t n = std::min(numElems, size_t(ret));
+    for (size_t i = 0; i < state->numChans; i++)
+    {
+        std::memcpy(state->writeBuffs[i], buffs[i], n*state->elemSize);
+    }
+    int releaseFlags = flags;
+    if (n != numElems) releaseFlags &= ~SOAPY_SDR_END_BURST;
+    this->releaseWriteBuffer(stream, handle, n, releaseFlags, timeNs);
+    return int(n);
 }
 
 int SoapySDR::Device::readStreamStatus(Stream *, size_t &, int &, long long &, const long)
@@ -136,9 +327,18 @@ int SoapySDR::Device::getDirectAccessBufferAddrs(Stream *, const size_t, void **
     return SOAPY_SDR_NOT_SUPPORTED;
 }
 
-int SoapySDR::Device::acquireReadBuffer(Stream *, size_t &, const void **, int &, long long &, const long)
+int SoapySDR::Device::acquireReadBuffer(Stream *stream, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
 {
-    return SOAPY_SDR_NOT_SUPPORTED;
+    auto state = getDefaultStream(this, stream);
+    if (state == nullptr or DefaultStreamGuard::active(this, stream)) return SOAPY_SDR_NOT_SUPPORTED;
+    allocateDefaultBuffers(this, stream, *state);
+
+    DefaultStreamGuard guard(this, stream);
+    const int ret = this->readStream(stream, state->buffs.getBuffers(), this->getStreamMTU(stream), flags, timeNs, timeoutUs);
+    if (ret <= 0) return ret;
+    handle = 0;
+    for (size_t i = 0; i < state->numChans; i++) buffs[i] = state->buffs.getBuffer(i);
+    return ret;
 }
 
 void SoapySDR::Device::releaseReadBuffer(Stream *, const size_t)
@@ -146,14 +346,81 @@ void SoapySDR::Device::releaseReadBuffer(Stream *, const size_t)
     return;
 }
 
-int SoapySDR::Device::acquireWriteBuffer(Stream *, size_t &, void **, const long)
+int SoapySDR::Device::acquireWriteBuffer(Stream *stream, size_t &handle, void **buffs, const long)
 {
-    return SOAPY_SDR_NOT_SUPPORTED;
+    auto state = getDefaultStream(this, stream);
+    if (state == nullptr or DefaultStreamGuard::active(this, stream)) return SOAPY_SDR_NOT_SUPPORTED;
+    allocateDefaultBuffers(this, stream, *state);
+
+    handle = 0;
+    for (size_t i = 0; i < state->numChans; i++) buffs[i] = state->buffs.getBuffer(i);
+    return int(this->getStreamMTU(stream));
 }
 
-void SoapySDR::Device::releaseWriteBuffer(Stream *, const size_t, const size_t, int &, const long long)
+//consecutive write timeouts before the default releaseWriteBuffer() gives up,
+//about one second with the default writeStream() timeout
+static const size_t DEFAULT_WRITE_MAX_TIMEOUTS = 10;
+
+void SoapySDR::Device::releaseWriteBuffer(Stream *stream, const size_t, const size_t numElems, int &flags, const long long timeNs)
 {
-    return;
+    auto state = getDefaultStream(this, stream);
+    if (state == nullptr or DefaultStreamGuard::active(this, stream)) return;
+
+    //send the internal buffer, the time only applies to the first element
+    DefaultStreamGuard guard(this, stream);
+    for (size_t i = 0; i < state->numChans; i++) state->writeSrcs[i] = state->buffs.getBuffer(i);
+    int writeFlags = flags;
+    size_t numTimeouts(0);
+    for (size_t done = 0; done < numElems;)
+    {
+        int ret = this->writeStream(stream, state->writeSrcs.data(), numElems-done, writeFlags, timeNs);
+        if (ret == 0) ret = SOAPY_SDR_TIMEOUT;
+        if (ret == SOAPY_SDR_TIMEOUT and ++numTimeouts < DEFAULT_WRITE_MAX_TIMEOUTS) continue;
+        if (ret < 0)
+        {
+            //there is no return value, so the rest of the buffer is dropped with a log
+            SoapySDR::logf(SOAPY_SDR_ERROR, "releaseWriteBuffer() dropped %d elements: %s", int(numElems-done), SoapySDR::errToStr(ret));
+            break;
+        }
+        numTimeouts = 0;
+        done += size_t(ret);
+        writeFlags &= ~SOAPY_SDR_HAS_TIME;
+        for (auto &src : state->writeSrcs) src = (const char *)src + size_t(ret)*state->elemSize;
+    }
+}
+
+/*******************************************************************
+ * Default stream support
+ ******************************************************************/
+void SoapySDR::Device::setupDefaultStream(Stream *stream, const std::string &format, const size_t numChans)
+{
+    std::shared_ptr<DefaultStreamState> state(new DefaultStreamState());
+    state->elemSize = SoapySDR::formatToSize(format);
+    if (state->elemSize == 0) throw std::invalid_argument("setupDefaultStream() unknown format "+format);
+    state->numChans = numChans;
+    state->readBuffs.resize(numChans);
+    state->readHandle = 0;
+    state->readOffset = 0;
+    state->readElems = 0;
+    state->readFlags = 0;
+    state->readTimeNs = 0;
+    state->writeBuffs.resize(numChans);
+    state->writeSrcs.resize(numChans);
+
+    std::lock_guard<std::mutex> lock(getDefaultStreamsMutex());
+    getDefaultStreams()[this][stream] = state;
+    defaultStreamsVersion++;
+}
+
+void SoapySDR::Device::closeDefaultStream(Stream *stream)
+{
+    std::lock_guard<std::mutex> lock(getDefaultStreamsMutex());
+    auto &streams = getDefaultStreams();
+    const auto it = streams.find(this);
+    if (it == streams.end()) return;
+    it->second.erase(stream);
+    if (it->second.empty()) streams.erase(it);
+    defaultStreamsVersion++;
 }
 
 /*******************************************************************
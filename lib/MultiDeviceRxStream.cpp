@@ -0,0 +1,225 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/MultiDeviceRxStream.hpp>
+#include <SoapySDR/BufferedStreams.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Time.hpp>
+#include <algorithm> //min/max
+#include <chrono>
+#include <cstring> //memcpy
+#include <stdexcept>
+
+/***********************************************************************
+ * The read position of one device, in ticks of the sample rate
+ **********************************************************************/
+struct DeviceCursor
+{
+    DeviceCursor(SoapySDR::Device *device, SoapySDR::Stream *stream, const std::string &format, const size_t numChans, const size_t numChunks, const int bufferFlags):
+        stream(device, stream, format, numChans, numChunks, bufferFlags),
+        buffs(numChans),
+        numElems(0),
+        tick(0),
+        timed(false)
+    {
+        return;
+    }
+
+    SoapySDR::BufferedRxStream stream;
+
+    //the unread elements of the front chunk and the tick of the first one
+    std::vector<const void *> buffs;
+    size_t numElems;
+    long long tick;
+
+    //is the tick known? not before the first time stamp or after a gap
+    bool timed;
+};
+
+struct SoapySDR::MultiDeviceRxStream::Impl
+{
+    int acquire(DeviceCursor &cursor, const std::chrono::steady_clock::time_point &exitTime);
+    void release(DeviceCursor &cursor, const size_t numElems);
+
+    std::vector<std::unique_ptr<DeviceCursor>> cursors;
+    size_t elemSize;
+    size_t numChans;
+    double rate;
+
+    //the tick of the next element of the aggregate stream
+    bool started;
+    long long nextTick;
+    size_t numGaps;
+};
+
+int SoapySDR::MultiDeviceRxStream::Impl::acquire(DeviceCursor &cursor, const std::chrono::steady_clock::time_point &exitTime)
+{
+    while (true)
+    {
+        const auto timeoutUs = std::chrono::duration_cast<std::chrono::microseconds>(exitTime-std::chrono::steady_clock::now()).count();
+        int flags(0);
+        long long timeNs(0);
+        const int ret = cursor.stream.acquire(cursor.buffs.data(), flags, timeNs, long(std::max<long long>(timeoutUs, 0)));
+
+        //the time of the elements after a gap is only known from the next time stamp
+        if (ret == SOAPY_SDR_OVERFLOW)
+        {
+            cursor.timed = false;
+            continue;
+        }
+        if (ret <= 0) return ret;
+
+        if ((flags & SOAPY_SDR_HAS_TIME) != 0)
+        {
+            cursor.tick = SoapySDR::timeNsToTicks(timeNs, rate);
+            cursor.timed = true;
+        }
+
+        //elements without a known time cannot be aligned
+        if (not cursor.timed)
+        {
+            cursor.stream.release(size_t(ret));
+            continue;
+        }
+        cursor.numElems = size_t(ret);
+        return ret;
+    }
+}
+
+void SoapySDR::MultiDeviceRxStream::Impl::release(DeviceCursor &cursor, const size_t numElems)
+{
+    cursor.stream.release(numElems);
+    cursor.numElems -= numElems;
+    cursor.tick += (long long)numElems;
+}
+
+/***********************************************************************
+ * MultiDeviceRxStream implementation
+ **********************************************************************/
+SoapySDR::MultiDeviceRxStream::MultiDeviceRxStream(
+    const std::vector<Device *> &devices,
+    const std::vector<Stream *> &streams,
+    const std::string &format,
+    const size_t numChans,
+    const double sampleRate,
+    const size_t numChunks,
+    const int bufferFlags):
+    _impl(new Impl())
+{
+    if (devices.empty() or devices.size() != streams.size()) throw std::invalid_argument("MultiDeviceRxStream() device and stream lists differ");
+    if (not (sampleRate > 0.0)) throw std::invalid_argument("MultiDeviceRxStream() sample rate is not positive");
+
+    for (size_t i = 0; i < devices.size(); i++)
+    {
+        _impl->cursors.emplace_back(new DeviceCursor(devices[i], streams[i], format, numChans, numChunks, bufferFlags));
+    }
+    _impl->elemSize = SoapySDR::formatToSize(format);
+    _impl->numChans = numChans;
+    _impl->rate = sampleRate;
+    _impl->started = false;
+    _impl->nextTick = 0;
+    _impl->numGaps = 0;
+}
+
+SoapySDR::MultiDeviceRxStream::~MultiDeviceRxStream(void)
+{
+    return;
+}
+
+int SoapySDR::MultiDeviceRxStream::activate(const int flags, const long long timeNs, const size_t numElems)
+{
+    auto &cursors = _impl->cursors;
+    for (size_t i = 0; i < cursors.size(); i++)
+    {
+        const int ret = cursors[i]->stream.activate(flags, timeNs, numElems);
+        if (ret == 0) continue;
+        while (i != 0) cursors[--i]->stream.deactivate();
+        return ret;
+    }
+    _impl->started = false;
+    return 0;
+}
+
+int SoapySDR::MultiDeviceRxStream::deactivate(const int flags, const long long timeNs)
+{
+    int result = 0;
+    for (auto &cursor : _impl->cursors)
+    {
+        const int ret = cursor->stream.deactivate(flags, timeNs);
+        if (result == 0) result = ret;
+    }
+    return result;
+}
+
+size_t SoapySDR::MultiDeviceRxStream::getNumChannels(void) const
+{
+    return _impl->cursors.size()*_impl->numChans;
+}
+
+size_t SoapySDR::MultiDeviceRxStream::getMTU(void) const
+{
+    size_t mtu = _impl->cursors.front()->stream.getMTU();
+    for (const auto &cursor : _impl->cursors) mtu = std::min(mtu, cursor->stream.getMTU());
+    return mtu;
+}
+
+int SoapySDR::MultiDeviceRxStream::read(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+{
+    auto &impl = *_impl;
+    const auto exitTime = std::chrono::steady_clock::now() + std::chrono::microseconds(timeoutUs);
+
+    while (true)
+    {
+        //the front of every device, and the latest tick among them
+        long long startTick(0);
+        for (size_t i = 0; i < impl.cursors.size(); i++)
+        {
+            auto &cursor = *impl.cursors[i];
+            const int ret = impl.acquire(cursor, exitTime);
+            if (ret <= 0) return ret;
+            startTick = (i == 0)?cursor.tick:std::max(startTick, cursor.tick);
+        }
+
+        //discard the elements before the start, then acquire again from the new front
+        bool aligned = true;
+        for (auto &cursor : impl.cursors)
+        {
+            if (cursor->tick == startTick) continue;
+            impl.release(*cursor, size_t(std::min<long long>(startTick-cursor->tick, (long long)cursor->numElems)));
+            aligned = false;
+        }
+        if (not aligned) continue;
+
+        //any discontinuity of the aggregate stream is a gap
+        flags = SOAPY_SDR_HAS_TIME;
+        if (impl.started and startTick != impl.nextTick)
+        {
+            timeNs = SoapySDR::ticksToTimeNs(impl.nextTick, impl.rate);
+            impl.nextTick = startTick;
+            impl.numGaps++;
+            return SOAPY_SDR_OVERFLOW;
+        }
+
+        size_t n = numElems;
+        for (const auto &cursor : impl.cursors) n = std::min(n, cursor->numElems);
+        for (size_t i = 0; i < impl.cursors.size(); i++)
+        {
+            auto &cursor = *impl.cursors[i];
+            for (size_t j = 0; j < impl.numChans; j++)
+            {
+                std::memcpy(buffs[i*impl.numChans+j], cursor.buffs[j], n*impl.elemSize);
+            }
+            impl.release(cursor, n);
+        }
+
+        timeNs = SoapySDR::ticksToTimeNs(startTick, impl.rate);
+        impl.started = true;
+        impl.nextTick = startTick + (long long)n;
+        return int(n);
+    }
+}
+
+size_t SoapySDR::MultiDeviceRxStream::getNumGaps(void) const
+{
+    return _impl->numGaps;
+}
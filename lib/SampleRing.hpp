@@ -0,0 +1,115 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/Buffers.hpp>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+/*******************************************************************
+ * A single-producer/single-consumer ring of multi-channel chunks.
+ *
+ * Chunks are claimed and published without locks. The mutex and
+ * condition variable are only used to sleep on an empty or full
+ * ring, and the publishing side only takes the mutex when the
+ * other side is waiting.
+ ******************************************************************/
+class SampleRing
+{
+public:
+
+    //! One entry of the ring with the stream meta-data of its samples
+    struct Chunk
+    {
+        int ret; //!< 0 for samples or an error code in stream order
+        size_t numElems;
+        int flags;
+        long long timeNs;
+        void * const *buffs;
+    };
+
+    SampleRing(const size_t numChunks, const size_t numChans, const size_t numBytes, const int bufferFlags):
+        _pool(numChunks*numChans, numBytes, bufferFlags),
+        _chunks(numChunks),
+        _head(0),
+        _tail(0),
+        _waiters(0)
+    {
+        for (size_t i = 0; i < numChunks; i++) _chunks[i].buffs = _pool.getBuffers() + i*numChans;
+    }
+
+    //! The number of published chunks that were not consumed yet
+    size_t size(void) const
+    {
+        return _head.load() - _tail.load();
+    }
+
+    //! Producer: the next chunk to fill, or nullptr when the ring is full
+    Chunk *back(void)
+    {
+        const size_t head = _head.load(std::memory_order_relaxed);
+        if (head - _tail.load(std::memory_order_acquire) == _chunks.size()) return nullptr;
+        return &_chunks[head % _chunks.size()];
+    }
+
+    //! Producer: publish the chunk from back()
+    void push(void)
+    {
+        _head.fetch_add(1);
+        this->notify();
+    }
+
+    //! Consumer: the oldest published chunk, or nullptr when the ring is empty
+    Chunk *front(void)
+    {
+        const size_t tail = _tail.load(std::memory_order_relaxed);
+        if (_head.load(std::memory_order_acquire) == tail) return nullptr;
+        return &_chunks[tail % _chunks.size()];
+    }
+
+    //! Consumer: release the chunk from front() back to the producer
+    void pop(void)
+    {
+        _tail.fetch_add(1);
+        this->notify();
+    }
+
+    /*!
+     * Wait for a chunk from back() or front().
+     * The wait ends early when another thread calls notify(),
+     * so the caller must check for a chunk again.
+     */
+    template <typename Ready>
+    void wait(const long timeoutUs, const Ready &ready)
+    {
+        if (ready()) return;
+        _waiters.fetch_add(1);
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _cond.wait_for(lock, std::chrono::microseconds(timeoutUs), ready);
+        }
+        _waiters.fetch_sub(1);
+    }
+
+    //! Wake up the waiting side after a push, pop, or state change
+    void notify(void)
+    {
+        //sequentially consistent with the head and tail updates, so a wait is never missed
+        if (_waiters.load() == 0) return;
+        std::lock_guard<std::mutex> lock(_mutex);
+        _cond.notify_all();
+    }
+
+private:
+    SoapySDR::BufferPool _pool;
+    std::vector<Chunk> _chunks;
+    std::atomic<size_t> _head;
+    std::atomic<size_t> _tail;
+    std::atomic<int> _waiters;
+    std::mutex _mutex;
+    std::condition_variable _cond;
+};
@@ -0,0 +1,142 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "VectorizedConverters.hpp"
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Logger.hpp>
+#include <string>
+#include <set>
+#include <utility>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+/***********************************************************************
+ * Runtime CPU feature detection
+ **********************************************************************/
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+static bool cpuSupports(const std::string &feature)
+{
+    int info[4];
+    __cpuid(info, 0);
+    const int maxLeaf = info[0];
+    __cpuid(info, 1);
+    if (feature == "sse2") return (info[3] & (1 << 26)) != 0;
+    if (feature == "ssse3") return (info[2] & (1 << 9)) != 0;
+
+    //AVX state must be enabled by the OS as well as the processor
+    const bool osxsave = (info[2] & (1 << 27)) != 0;
+    if (not osxsave or maxLeaf < 7) return false;
+    const unsigned long long xcr0 = _xgetbv(0);
+    __cpuidex(info, 7, 0);
+    if (feature == "avx2") return (xcr0 & 0x6) == 0x6 and (info[1] & (1 << 5)) != 0;
+    if (feature == "avx512f") return (xcr0 & 0xe6) == 0xe6 and (info[1] & (1 << 16)) != 0;
+    return false;
+}
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+static bool cpuSupports(const std::string &feature)
+{
+    __builtin_cpu_init();
+    if (feature == "sse2") return __builtin_cpu_supports("sse2");
+    if (feature == "ssse3") return __builtin_cpu_supports("ssse3");
+    if (feature == "avx2") return __builtin_cpu_supports("avx2");
+    if (feature == "avx512f") return __builtin_cpu_supports("avx512f");
+    return false;
+}
+#else
+static bool cpuSupports(const std::string &)
+{
+    return false;
+}
+#endif
+
+/***********************************************************************
+ * Register the best available kernel for each conversion
+ **********************************************************************/
+static bool registerVectorizedConverters(void)
+{
+    //instruction sets in order of preference
+    typedef const VectorizedConverter *(*GetConverters)(size_t &);
+    typedef const VectorizedLayoutConverter *(*GetLayoutConverters)(size_t &);
+    typedef const VectorizedDecimator *(*GetDecimators)(size_t &);
+    struct InstructionSet
+    {
+        std::string name;
+        GetConverters getConverters;
+        GetLayoutConverters getLayoutConverters;
+        GetDecimators getDecimators;
+    };
+    const InstructionSet instructionSets[] = {
+        {"avx512f", &getAVX512Converters, nullptr, nullptr},
+        {"avx2", &getAVX2Converters, nullptr, nullptr},
+        {"ssse3", &getSSSE3Converters, nullptr, nullptr},
+        {"sse2", &getSSE2Converters, &getSSE2LayoutConverters, &getSSE2Decimators},
+    };
+
+    std::set<std::pair<std::string, std::string>> registered, deinterleaved, interleaved, decimated;
+    for (const auto &isa : instructionSets)
+    {
+        if (not cpuSupports(isa.name)) continue;
+
+        size_t length(0);
+        const auto converters = isa.getConverters(length);
+        for (size_t i = 0; i < length; i++)
+        {
+            const auto &conv = converters[i];
+            if (not registered.insert(std::make_pair(conv.sourceFormat, conv.targetFormat)).second) continue;
+
+            //every kernel runs through the block helpers, which are in-place safe unless widening
+            const bool inPlace = SoapySDR::formatToSize(conv.targetFormat) <= SoapySDR::formatToSize(conv.sourceFormat);
+            SoapySDR::ConverterRegistry(conv.sourceFormat, conv.targetFormat, SoapySDR::ConverterRegistry::VECTORIZED, conv.function, isa.name, inPlace);
+            SoapySDR::logf(SOAPY_SDR_DEBUG, "ConverterRegistry: %s -> %s using %s",
+                conv.sourceFormat, conv.targetFormat, isa.name.c_str());
+        }
+
+        length = 0;
+        const auto layoutConverters = (isa.getLayoutConverters == nullptr)?nullptr:isa.getLayoutConverters(length);
+        for (size_t i = 0; i < length; i++)
+        {
+            const auto &conv = layoutConverters[i];
+            const auto key = std::make_pair(std::string(conv.sourceFormat), std::string(conv.targetFormat));
+            if (conv.deinterleave != nullptr and deinterleaved.insert(key).second)
+            {
+                SoapySDR::ConverterRegistry(conv.sourceFormat, conv.targetFormat, SoapySDR::ConverterRegistry::VECTORIZED, conv.deinterleave);
+                SoapySDR::logf(SOAPY_SDR_DEBUG, "ConverterRegistry: deinterleave %s -> %s using %s",
+                    conv.sourceFormat, conv.targetFormat, isa.name.c_str());
+            }
+            if (conv.interleave != nullptr and interleaved.insert(key).second)
+            {
+                SoapySDR::ConverterRegistry(conv.sourceFormat, conv.targetFormat, SoapySDR::ConverterRegistry::VECTORIZED, conv.interleave);
+                SoapySDR::logf(SOAPY_SDR_DEBUG, "ConverterRegistry: interleave %s -> %s using %s",
+                    conv.sourceFormat, conv.targetFormat, isa.name.c_str());
+            }
+        }
+
+        length = 0;
+        const auto decimators = (isa.getDecimators == nullptr)?nullptr:isa.getDecimators(length);
+        for (size_t i = 0; i < length; i++)
+        {
+            const auto &conv = decimators[i];
+            if (not decimated.insert(std::make_pair(conv.sourceFormat, conv.targetFormat)).second) continue;
+            SoapySDR::ConverterRegistry(conv.sourceFormat, conv.targetFormat, SoapySDR::ConverterRegistry::VECTORIZED, conv.function);
+            SoapySDR::logf(SOAPY_SDR_DEBUG, "ConverterRegistry: decimate %s -> %s using %s",
+                conv.sourceFormat, conv.targetFormat, isa.name.c_str());
+        }
+    }
+    return true;
+}
+
+/*!
+ * lateLoadVectorizedConverters() is called by lateLoadDefaultConverters()
+ * to register the SIMD converters with VECTORIZED priority.
+ * The processor is queried once and the widest supported
+ * instruction set is selected for each source/target pair;
+ * the generic converters remain registered as a fallback.
+ */
+void lateLoadVectorizedConverters(void)
+{
+    static const bool registered = registerVectorizedConverters();
+    (void)registered;
+}
@@ -0,0 +1,116 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#pragma once
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <cstddef>
+#include <cstring> //memcpy
+
+/***********************************************************************
+ * Vectorized converter tables
+ *
+ * Each instruction set lives in its own translation unit which is
+ * compiled with the matching architecture flags. The tables are
+ * plain arrays so that those translation units never instantiate
+ * shared inline or template code that could leak into the rest
+ * of the library and execute on a processor without support.
+ **********************************************************************/
+struct VectorizedConverter
+{
+    const char *sourceFormat;
+    const char *targetFormat;
+    SoapySDR::ConverterRegistry::ConverterFunction function;
+};
+
+//! A channel layout kernel, only one of the two functions is set
+struct VectorizedLayoutConverter
+{
+    const char *sourceFormat;
+    const char *targetFormat;
+    SoapySDR::ConverterRegistry::DeinterleaveFunction deinterleave;
+    SoapySDR::ConverterRegistry::InterleaveFunction interleave;
+};
+
+//! A decimating converter kernel
+struct VectorizedDecimator
+{
+    const char *sourceFormat;
+    const char *targetFormat;
+    SoapySDR::ConverterRegistry::DecimateFunction function;
+};
+
+//! SSE2 converters, or nullptr when not built for this target
+const VectorizedConverter *getSSE2Converters(size_t &length);
+
+//! SSE2 channel layout converters, or nullptr when not built for this target
+const VectorizedLayoutConverter *getSSE2LayoutConverters(size_t &length);
+
+//! SSE2 decimating converters, or nullptr when not built for this target
+const VectorizedDecimator *getSSE2Decimators(size_t &length);
+
+//! SSSE3 converters, or nullptr when not built for this target
+const VectorizedConverter *getSSSE3Converters(size_t &length);
+
+//! AVX2 converters, or nullptr when not built for this target
+const VectorizedConverter *getAVX2Converters(size_t &length);
+
+//! AVX-512 converters, or nullptr when not built for this target
+const VectorizedConverter *getAVX512Converters(size_t &length);
+
+/***********************************************************************
+ * Run a fixed-size SIMD block over a buffer.
+ * The remainder is converted through a zero-padded copy of the input
+ * so every sample goes through the same instructions as the body.
+ * Blocks run front to back and load their input before storing,
+ * so kernels whose output is no wider than their input convert
+ * in-place, see registerVectorizedConverters().
+ * Internal linkage keeps each instantiation local to its own ISA.
+ **********************************************************************/
+template <size_t BlockSize, typename InType, typename OutType, typename BlockFcn>
+static inline void convertInBlocks(const InType *in, OutType *out, const size_t numSamps, const BlockFcn &block)
+{
+    size_t i = 0;
+    for (; i+BlockSize <= numSamps; i += BlockSize)
+    {
+        block(in+i, out+i);
+    }
+    if (i == numSamps) return;
+
+    InType tailIn[BlockSize] = {};
+    OutType tailOut[BlockSize];
+    std::memcpy(tailIn, in+i, (numSamps-i)*sizeof(InType));
+    block(tailIn, tailOut);
+    std::memcpy(out+i, tailOut, (numSamps-i)*sizeof(OutType));
+}
+
+/***********************************************************************
+ * Run a fixed-size SIMD block over a buffer of packed elements.
+ * Each block converts BlockElems elements but may read up to
+ * InReadSize bytes of input, so the main loop stops early enough
+ * to stay inside the buffer and the remainder is converted
+ * through zero-padded copies of the input and output.
+ * The in-place rule of convertInBlocks() applies here as well.
+ **********************************************************************/
+template <size_t BlockElems, size_t InElemSize, size_t OutElemSize, size_t InReadSize, typename BlockFcn>
+static inline void convertPackedInBlocks(const void *inBuff, void *outBuff, const size_t numElems, const BlockFcn &block)
+{
+    auto *in = (const unsigned char *)inBuff;
+    auto *out = (unsigned char *)outBuff;
+
+    size_t i = 0;
+    for (; i+BlockElems <= numElems and (numElems-i)*InElemSize >= InReadSize; i += BlockElems)
+    {
+        block(in+i*InElemSize, out+i*OutElemSize);
+    }
+
+    while (i < numElems)
+    {
+        const size_t n = (numElems-i < BlockElems)?(numElems-i):BlockElems;
+        unsigned char tailIn[(InReadSize > BlockElems*InElemSize)?InReadSize:BlockElems*InElemSize] = {};
+        unsigned char tailOut[BlockElems*OutElemSize];
+        std::memcpy(tailIn, in+i*InElemSize, n*InElemSize);
+        block(tailIn, tailOut);
+        std::memcpy(out+i*OutElemSize, tailOut, n*OutElemSize);
+        i += n;
+    }
+}
@@ -0,0 +1,552 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "VectorizedConverters.hpp"
+#include "ConverterHelpers.hpp"
+#include <SoapySDR/Formats.h>
+#include <stdint.h>
+
+#ifdef __AVX2__
+#include <immintrin.h>
+
+// ********************************
+// AVX2 Helpers
+
+//unpack 8 complex CS12 elements (24 of 28 loaded bytes) into 16 left justified int16
+static inline __m256i avx2UnpackCS12(const unsigned char *in)
+{
+  //each 128-bit lane holds 12 input bytes, the shuffle operates per lane
+  const __m256i x = _mm256_inserti128_si256(_mm256_castsi128_si256(
+    _mm_loadu_si128((const __m128i *)(in+0))), _mm_loadu_si128((const __m128i *)(in+12)), 1);
+  const __m256i shuffle = _mm256_setr_epi8(
+    0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11,
+    0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+  const __m256i y = _mm256_shuffle_epi8(x, shuffle);
+  const __m256i i16 = _mm256_and_si256(_mm256_slli_epi16(y, 4), _mm256_set1_epi32(0x0000ffff));
+  const __m256i q16 = _mm256_and_si256(y, _mm256_set1_epi32(int(0xfff00000)));
+  return _mm256_or_si256(i16, q16);
+}
+
+//pack 16 left justified int16 into 8 complex CS12 elements (24 bytes)
+static inline void avx2PackCS12(const __m256i x, unsigned char *out)
+{
+  const __m256i i12 = _mm256_srli_epi32(_mm256_and_si256(x, _mm256_set1_epi32(0x0000fff0)), 4);
+  const __m256i q12 = _mm256_srli_epi32(_mm256_and_si256(x, _mm256_set1_epi32(int(0xfff00000))), 8);
+  const __m256i shuffle = _mm256_setr_epi8(
+    0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+    0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+  const __m256i packed = _mm256_shuffle_epi8(_mm256_or_si256(i12, q12), shuffle);
+  const __m128i lanes[2] = {_mm256_castsi256_si128(packed), _mm256_extracti128_si256(packed, 1)};
+  for (size_t j = 0; j < 2; j++)
+    {
+      const int top = _mm_cvtsi128_si32(_mm_srli_si128(lanes[j], 8));
+      _mm_storel_epi64((__m128i *)(out+j*12), lanes[j]);
+      std::memcpy(out+j*12+8, &top, sizeof(top));
+    }
+}
+
+//convert 8 scaled floats into 8 saturated int32:
+//overflow converts to INT32_MIN, flip it to INT32_MAX for positive inputs
+static inline __m256i avx2F32toS32(const __m256 x)
+{
+  const __m256 overflow = _mm256_cmp_ps(x, _mm256_set1_ps(2147483648.0f), _CMP_GE_OQ);
+  return _mm256_xor_si256(_mm256_cvttps_epi32(x), _mm256_castps_si256(overflow));
+}
+
+//convert 16 int16 into 16 scaled floats
+static inline void avx2S16toF32(const __m256i x, float *out, const __m256 scale)
+{
+  const __m256i lo = _mm256_cvtepi16_epi32(_mm256_castsi256_si128(x));
+  const __m256i hi = _mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1));
+  _mm256_storeu_ps(out+0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+  _mm256_storeu_ps(out+8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+}
+
+//convert 32 scaled floats into 32 saturated int8
+static inline __m256i avx2F32toS8(const float *in, const __m256 scale)
+{
+  const __m256i in0 = avx2F32toS32(_mm256_mul_ps(_mm256_loadu_ps(in+0), scale));
+  const __m256i in1 = avx2F32toS32(_mm256_mul_ps(_mm256_loadu_ps(in+8), scale));
+  const __m256i in2 = avx2F32toS32(_mm256_mul_ps(_mm256_loadu_ps(in+16), scale));
+  const __m256i in3 = avx2F32toS32(_mm256_mul_ps(_mm256_loadu_ps(in+24), scale));
+  //packs operates per 128-bit lane, restore the sample order afterwards
+  const __m256i packed = _mm256_packs_epi16(_mm256_packs_epi32(in0, in1), _mm256_packs_epi32(in2, in3));
+  const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+  return _mm256_permutevar8x32_epi32(packed, order);
+}
+
+//convert 16 scaled floats into 16 saturated int16
+static inline __m256i avx2F32toS16(const __m256 lo, const __m256 hi)
+{
+  //packs operates per 128-bit lane, restore the sample order afterwards
+  const __m256i packed = _mm256_packs_epi32(avx2F32toS32(lo), avx2F32toS32(hi));
+  return _mm256_permute4x64_epi64(packed, 0xd8);
+}
+
+//scale 16 int16 through float, truncating like the generic converters
+static inline __m256i avx2ScaleS16(const __m256i x, const __m256 scale)
+{
+  const __m256 lo = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_castsi256_si128(x))), scale);
+  const __m256 hi = _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm256_extracti128_si256(x, 1))), scale);
+  return avx2F32toS16(lo, hi);
+}
+
+//swap the byte order of 16 int16
+static inline __m256i avx2SwapS16(const __m256i x)
+{
+  const __m256i shuffle = _mm256_setr_epi8(
+    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+    1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+  return _mm256_shuffle_epi8(x, shuffle);
+}
+
+//swap the byte order of 8 int32
+static inline __m256i avx2SwapS32(const __m256i x)
+{
+  const __m256i shuffle = _mm256_setr_epi8(
+    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+  return _mm256_shuffle_epi8(x, shuffle);
+}
+
+//power of 8 complex floats held in two vectors: re*re + im*im
+static inline __m256 avx2PowerCF32(const __m256 a, const __m256 b)
+{
+  const __m256 a2 = _mm256_mul_ps(a, a);
+  const __m256 b2 = _mm256_mul_ps(b, b);
+  const __m256 power = _mm256_add_ps(_mm256_shuffle_ps(a2, b2, _MM_SHUFFLE(2, 0, 2, 0)), _mm256_shuffle_ps(a2, b2, _MM_SHUFFLE(3, 1, 3, 1)));
+  //shuffle operates per 128-bit lane, restore the sample order afterwards
+  return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(power), 0xd8));
+}
+
+static inline __m256 avx2PowerToPower(const __m256 power)
+{
+  return power;
+}
+
+static inline __m256 avx2PowerToMagnitude(const __m256 power)
+{
+  return _mm256_sqrt_ps(power);
+}
+
+//vector form of fastLog2 with the same operation order, scaled to dB
+static inline __m256 avx2PowerToDB(const __m256 power)
+{
+  const __m256i bits = _mm256_castps_si256(power);
+  const __m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+  const __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007fffff)), _mm256_set1_epi32(0x3f800000)));
+  __m256 poly = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(FAST_LOG2_C3), m), _mm256_set1_ps(FAST_LOG2_C2));
+  poly = _mm256_add_ps(_mm256_mul_ps(poly, m), _mm256_set1_ps(FAST_LOG2_C1));
+  poly = _mm256_add_ps(_mm256_mul_ps(poly, m), _mm256_set1_ps(FAST_LOG2_C0));
+  const __m256 log2 = _mm256_add_ps(e, _mm256_mul_ps(_mm256_sub_ps(m, _mm256_set1_ps(1.0f)), poly));
+  return _mm256_mul_ps(_mm256_set1_ps(LOG2_TO_DB), log2);
+}
+
+//convert 8 int32 into 8 scaled doubles
+static inline void avx2S32toF64(const __m256i x, double *out, const __m256d scale)
+{
+  _mm256_storeu_pd(out+0, _mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_castsi256_si128(x)), scale));
+  _mm256_storeu_pd(out+4, _mm256_mul_pd(_mm256_cvtepi32_pd(_mm256_extracti128_si256(x, 1)), scale));
+}
+
+//convert float samples into scaled doubles
+static void avx2WidenF32(const float *src, double *dst, const size_t numSamps, const double scaler)
+{
+  const __m256d scale = _mm256_set1_pd(scaler);
+  convertInBlocks<8>(src, dst, numSamps, [&scale](const float *in, double *out)
+    {
+      _mm256_storeu_pd(out+0, _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(in+0)), scale));
+      _mm256_storeu_pd(out+4, _mm256_mul_pd(_mm256_cvtps_pd(_mm_loadu_ps(in+4)), scale));
+    });
+}
+
+//convert double samples into scaled floats
+static void avx2NarrowF64(const double *src, float *dst, const size_t numSamps, const double scaler)
+{
+  const __m256d scale = _mm256_set1_pd(scaler);
+  convertInBlocks<8>(src, dst, numSamps, [&scale](const double *in, float *out)
+    {
+      _mm_storeu_ps(out+0, _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_loadu_pd(in+0), scale)));
+      _mm_storeu_ps(out+4, _mm256_cvtpd_ps(_mm256_mul_pd(_mm256_loadu_pd(in+4), scale)));
+    });
+}
+
+// ********************************
+// AVX2 Converters
+
+// CS16 <> CF32
+static void avx2CS16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const __m256 scale = _mm256_set1_ps(float(scaler/32768.0));
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&scale](const int16_t *in, float *out)
+    {
+      const __m256i lo = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(in+0)));
+      const __m256i hi = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(in+8)));
+      _mm256_storeu_ps(out+0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+      _mm256_storeu_ps(out+8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+    });
+}
+
+static void avx2CF32toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  const __m256 scale = _mm256_set1_ps(float(scaler*32768.0));
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&scale](const float *in, int16_t *out)
+    {
+      const __m256i lo = avx2F32toS32(_mm256_mul_ps(_mm256_loadu_ps(in+0), scale));
+      const __m256i hi = avx2F32toS32(_mm256_mul_ps(_mm256_loadu_ps(in+8), scale));
+      //packs operates per 128-bit lane, restore the sample order afterwards
+      const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(lo, hi), 0xd8);
+      _mm256_storeu_si256((__m256i *)out, packed);
+    });
+}
+
+// CS8 <> CF32
+static void avx2CS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const __m256 scale = _mm256_set1_ps(float(scaler/128.0));
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&scale](const int8_t *in, float *out)
+    {
+      const __m256i lo = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(in+0)));
+      const __m256i hi = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(in+8)));
+      _mm256_storeu_ps(out+0, _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale));
+      _mm256_storeu_ps(out+8, _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale));
+    });
+}
+
+static void avx2CF32toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  const __m256 scale = _mm256_set1_ps(float(scaler*128.0));
+  convertInBlocks<32>(src, dst, numElems*elemDepth, [&scale](const float *in, int8_t *out)
+    {
+      _mm256_storeu_si256((__m256i *)out, avx2F32toS8(in, scale));
+    });
+}
+
+// CF32 -> CU8
+static void avx2CF32toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  const __m256 scale = _mm256_set1_ps(float(scaler*128.0));
+  const __m256i offset = _mm256_set1_epi8(int8_t(0x80));
+  convertInBlocks<32>(src, dst, numElems*elemDepth, [&](const float *in, uint8_t *out)
+    {
+      _mm256_storeu_si256((__m256i *)out, _mm256_xor_si256(avx2F32toS8(in, scale), offset));
+    });
+}
+
+// CS12 <> CS16
+static void avx2CS12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m256 scale = _mm256_set1_ps(float(scaler));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<8, 3, 4, 28>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      const __m256i x = avx2UnpackCS12(in);
+      _mm256_storeu_si256((__m256i *)out, unity?x:avx2ScaleS16(x, scale));
+    });
+}
+
+static void avx2CS16toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m256 scale = _mm256_set1_ps(float(scaler));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<8, 4, 3, 32>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      const __m256i x = _mm256_loadu_si256((const __m256i *)in);
+      avx2PackCS12(unity?x:avx2ScaleS16(x, scale), out);
+    });
+}
+
+// CS12 <> CF32
+static void avx2CS12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m256 scale = _mm256_set1_ps(float(scaler/32768.0));
+  convertPackedInBlocks<8, 3, 8, 28>(srcBuff, dstBuff, numElems, [&scale](const unsigned char *in, unsigned char *out)
+    {
+      avx2S16toF32(avx2UnpackCS12(in), (float *)out, scale);
+    });
+}
+
+static void avx2CF32toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m256 scale = _mm256_set1_ps(float(scaler*32768.0));
+  convertPackedInBlocks<8, 8, 3, 64>(srcBuff, dstBuff, numElems, [&scale](const unsigned char *in, unsigned char *out)
+    {
+      const __m256 lo = _mm256_mul_ps(_mm256_loadu_ps((const float *)in+0), scale);
+      const __m256 hi = _mm256_mul_ps(_mm256_loadu_ps((const float *)in+8), scale);
+      avx2PackCS12(avx2F32toS16(lo, hi), out);
+    });
+}
+
+// CU12 <> CS16
+static void avx2CU12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m256 scale = _mm256_set1_ps(float(scaler));
+  const __m256i offset = _mm256_set1_epi16(int16_t(0x8000));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<8, 3, 4, 28>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      const __m256i x = _mm256_xor_si256(avx2UnpackCS12(in), offset);
+      _mm256_storeu_si256((__m256i *)out, unity?x:avx2ScaleS16(x, scale));
+    });
+}
+
+static void avx2CS16toCU12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m256 scale = _mm256_set1_ps(float(scaler));
+  const __m256i offset = _mm256_set1_epi16(int16_t(0x8000));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<8, 4, 3, 32>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      const __m256i x = _mm256_loadu_si256((const __m256i *)in);
+      avx2PackCS12(_mm256_xor_si256(unity?x:avx2ScaleS16(x, scale), offset), out);
+    });
+}
+
+// CU12 <> CF32
+static void avx2CU12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m256 scale = _mm256_set1_ps(float(scaler/32768.0));
+  const __m256i offset = _mm256_set1_epi16(int16_t(0x8000));
+  convertPackedInBlocks<8, 3, 8, 28>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      avx2S16toF32(_mm256_xor_si256(avx2UnpackCS12(in), offset), (float *)out, scale);
+    });
+}
+
+static void avx2CF32toCU12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m256 scale = _mm256_set1_ps(float(scaler*32768.0));
+  const __m256i offset = _mm256_set1_epi16(int16_t(0x8000));
+  convertPackedInBlocks<8, 8, 3, 64>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      const __m256 lo = _mm256_mul_ps(_mm256_loadu_ps((const float *)in+0), scale);
+      const __m256 hi = _mm256_mul_ps(_mm256_loadu_ps((const float *)in+8), scale);
+      avx2PackCS12(_mm256_xor_si256(avx2F32toS16(lo, hi), offset), out);
+    });
+}
+
+// F32 <> F64
+static void avx2F32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  avx2WidenF32((const float*)srcBuff, (double*)dstBuff, numElems, scaler);
+}
+
+static void avx2F64toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  avx2NarrowF64((const double*)srcBuff, (float*)dstBuff, numElems, scaler);
+}
+
+// CF32 <> CF64
+static void avx2CF32toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2WidenF32((const float*)srcBuff, (double*)dstBuff, numElems*elemDepth, scaler);
+}
+
+static void avx2CF64toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  avx2NarrowF64((const double*)srcBuff, (float*)dstBuff, numElems*elemDepth, scaler);
+}
+
+// CS16 -> CF64
+static void avx2CS16toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  const __m256d scale = _mm256_set1_pd(scaler/32768.0);
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&scale](const int16_t *in, double *out)
+    {
+      avx2S32toF64(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(in+0))), out+0, scale);
+      avx2S32toF64(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)(in+8))), out+8, scale);
+    });
+}
+
+// CS8 -> CF64
+static void avx2CS8toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  const __m256d scale = _mm256_set1_pd(scaler/128.0);
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&scale](const int8_t *in, double *out)
+    {
+      avx2S32toF64(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(in+0))), out+0, scale);
+      avx2S32toF64(_mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(in+8))), out+8, scale);
+    });
+}
+
+// CS16BE <> CF32
+static void avx2CS16BEtoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const __m256 scale = _mm256_set1_ps(float(scaler/32768.0));
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&scale](const int16_t *in, float *out)
+    {
+      avx2S16toF32(avx2SwapS16(_mm256_loadu_si256((const __m256i *)in)), out, scale);
+    });
+}
+
+static void avx2CF32toCS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  const __m256 scale = _mm256_set1_ps(float(scaler*32768.0));
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&scale](const float *in, int16_t *out)
+    {
+      const __m256 lo = _mm256_mul_ps(_mm256_loadu_ps(in+0), scale);
+      const __m256 hi = _mm256_mul_ps(_mm256_loadu_ps(in+8), scale);
+      _mm256_storeu_si256((__m256i *)out, avx2SwapS16(avx2F32toS16(lo, hi)));
+    });
+}
+
+// CS32BE <> CF32
+static void avx2CS32BEtoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int32_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const __m256 scale = _mm256_set1_ps(float(scaler/2147483648.0));
+  convertInBlocks<8>(src, dst, numElems*elemDepth, [&scale](const int32_t *in, float *out)
+    {
+      const __m256i x = avx2SwapS32(_mm256_loadu_si256((const __m256i *)in));
+      _mm256_storeu_ps(out, _mm256_mul_ps(_mm256_cvtepi32_ps(x), scale));
+    });
+}
+
+static void avx2CF32toCS32BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  const __m256 scale = _mm256_set1_ps(float(scaler*2147483648.0));
+  convertInBlocks<8>(src, dst, numElems*elemDepth, [&scale](const float *in, int32_t *out)
+    {
+      const __m256i x = avx2F32toS32(_mm256_mul_ps(_mm256_loadu_ps(in), scale));
+      _mm256_storeu_si256((__m256i *)out, avx2SwapS32(x));
+    });
+}
+
+// CF32 -> F32POW/F32MAG/F32DB
+template <__m256 (*Finish)(const __m256)>
+static void avx2CF32toPower(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m256 scale = _mm256_set1_ps(float(scaler));
+  convertPackedInBlocks<8, 8, 4, 64>(srcBuff, dstBuff, numElems, [&scale](const unsigned char *in, unsigned char *out)
+    {
+      const __m256 a = _mm256_mul_ps(_mm256_loadu_ps((const float *)in+0), scale);
+      const __m256 b = _mm256_mul_ps(_mm256_loadu_ps((const float *)in+8), scale);
+      _mm256_storeu_ps((float *)out, Finish(avx2PowerCF32(a, b)));
+    });
+}
+
+// CS16 -> F32POW/F32MAG/F32DB
+template <__m256 (*Finish)(const __m256)>
+static void avx2CS16toPower(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m256 scale = _mm256_set1_ps(float(scaler/32768.0));
+  convertPackedInBlocks<8, 4, 4, 32>(srcBuff, dstBuff, numElems, [&scale](const unsigned char *in, unsigned char *out)
+    {
+      const __m256i lo = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)in+0));
+      const __m256i hi = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)in+1));
+      const __m256 a = _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale);
+      const __m256 b = _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale);
+      _mm256_storeu_ps((float *)out, Finish(avx2PowerCF32(a, b)));
+    });
+}
+
+// CS8 -> F32POW/F32MAG/F32DB
+template <__m256 (*Finish)(const __m256)>
+static void avx2CS8toPower(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m256 scale = _mm256_set1_ps(float(scaler/128.0));
+  convertPackedInBlocks<8, 2, 4, 16>(srcBuff, dstBuff, numElems, [&scale](const unsigned char *in, unsigned char *out)
+    {
+      const __m256i lo = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(in+0)));
+      const __m256i hi = _mm256_cvtepi8_epi32(_mm_loadl_epi64((const __m128i *)(in+8)));
+      const __m256 a = _mm256_mul_ps(_mm256_cvtepi32_ps(lo), scale);
+      const __m256 b = _mm256_mul_ps(_mm256_cvtepi32_ps(hi), scale);
+      _mm256_storeu_ps((float *)out, Finish(avx2PowerCF32(a, b)));
+    });
+}
+
+static const VectorizedConverter avx2Converters[] = {
+  {SOAPY_SDR_CS16, SOAPY_SDR_CF32, &avx2CS16toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS16, &avx2CF32toCS16},
+  {SOAPY_SDR_CS8, SOAPY_SDR_CF32, &avx2CS8toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS8, &avx2CF32toCS8},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CU8, &avx2CF32toCU8},
+  {SOAPY_SDR_CS12, SOAPY_SDR_CS16, &avx2CS12toCS16},
+  {SOAPY_SDR_CS16, SOAPY_SDR_CS12, &avx2CS16toCS12},
+  {SOAPY_SDR_CS12, SOAPY_SDR_CF32, &avx2CS12toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS12, &avx2CF32toCS12},
+  {SOAPY_SDR_CU12, SOAPY_SDR_CS16, &avx2CU12toCS16},
+  {SOAPY_SDR_CS16, SOAPY_SDR_CU12, &avx2CS16toCU12},
+  {SOAPY_SDR_CU12, SOAPY_SDR_CF32, &avx2CU12toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CU12, &avx2CF32toCU12},
+  {SOAPY_SDR_F32, SOAPY_SDR_F64, &avx2F32toF64},
+  {SOAPY_SDR_F64, SOAPY_SDR_F32, &avx2F64toF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CF64, &avx2CF32toCF64},
+  {SOAPY_SDR_CF64, SOAPY_SDR_CF32, &avx2CF64toCF32},
+  {SOAPY_SDR_CS16, SOAPY_SDR_CF64, &avx2CS16toCF64},
+  {SOAPY_SDR_CS8, SOAPY_SDR_CF64, &avx2CS8toCF64},
+  {SOAPY_SDR_CS16BE, SOAPY_SDR_CF32, &avx2CS16BEtoCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS16BE, &avx2CF32toCS16BE},
+  {SOAPY_SDR_CS32BE, SOAPY_SDR_CF32, &avx2CS32BEtoCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS32BE, &avx2CF32toCS32BE},
+  {SOAPY_SDR_CF32, SOAPY_SDR_F32POW, &avx2CF32toPower<avx2PowerToPower>},
+  {SOAPY_SDR_CF32, SOAPY_SDR_F32MAG, &avx2CF32toPower<avx2PowerToMagnitude>},
+  {SOAPY_SDR_CF32, SOAPY_SDR_F32DB, &avx2CF32toPower<avx2PowerToDB>},
+  {SOAPY_SDR_CS16, SOAPY_SDR_F32POW, &avx2CS16toPower<avx2PowerToPower>},
+  {SOAPY_SDR_CS16, SOAPY_SDR_F32MAG, &avx2CS16toPower<avx2PowerToMagnitude>},
+  {SOAPY_SDR_CS16, SOAPY_SDR_F32DB, &avx2CS16toPower<avx2PowerToDB>},
+  {SOAPY_SDR_CS8, SOAPY_SDR_F32POW, &avx2CS8toPower<avx2PowerToPower>},
+  {SOAPY_SDR_CS8, SOAPY_SDR_F32MAG, &avx2CS8toPower<avx2PowerToMagnitude>},
+  {SOAPY_SDR_CS8, SOAPY_SDR_F32DB, &avx2CS8toPower<avx2PowerToDB>},
+};
+
+const VectorizedConverter *getAVX2Converters(size_t &length)
+{
+  length = sizeof(avx2Converters)/sizeof(avx2Converters[0]);
+  return avx2Converters;
+}
+
+#else
+
+const VectorizedConverter *getAVX2Converters(size_t &length)
+{
+  length = 0;
+  return nullptr;
+}
+
+#endif
@@ -0,0 +1,140 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "VectorizedConverters.hpp"
+#include <SoapySDR/Formats.h>
+#include <stdint.h>
+
+#ifdef __AVX512F__
+
+//gcc 12 intrinsic headers trigger false positives on _mm512_undefined_*()
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+#include <immintrin.h>
+
+// ********************************
+// AVX-512 Helpers
+
+//convert 16 scaled floats into 16 saturated int32:
+//overflow converts to INT32_MIN, replace it with INT32_MAX for positive inputs
+static inline __m512i avx512F32toS32(const __m512 x)
+{
+  const __mmask16 overflow = _mm512_cmp_ps_mask(x, _mm512_set1_ps(2147483648.0f), _CMP_GE_OQ);
+  return _mm512_mask_mov_epi32(_mm512_cvttps_epi32(x), overflow, _mm512_set1_epi32(0x7fffffff));
+}
+
+// ********************************
+// AVX-512 Converters
+//
+// Only AVX-512F instructions are used,
+// the saturating down-converts replace the pack/permute steps.
+
+// CS16 <> CF32
+static void avx512CS16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const __m512 scale = _mm512_set1_ps(float(scaler/32768.0));
+  convertInBlocks<32>(src, dst, numElems*elemDepth, [&scale](const int16_t *in, float *out)
+    {
+      const __m512i lo = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)(in+0)));
+      const __m512i hi = _mm512_cvtepi16_epi32(_mm256_loadu_si256((const __m256i *)(in+16)));
+      _mm512_storeu_ps(out+0, _mm512_mul_ps(_mm512_cvtepi32_ps(lo), scale));
+      _mm512_storeu_ps(out+16, _mm512_mul_ps(_mm512_cvtepi32_ps(hi), scale));
+    });
+}
+
+static void avx512CF32toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  const __m512 scale = _mm512_set1_ps(float(scaler*32768.0));
+  convertInBlocks<32>(src, dst, numElems*elemDepth, [&scale](const float *in, int16_t *out)
+    {
+      const __m512i lo = avx512F32toS32(_mm512_mul_ps(_mm512_loadu_ps(in+0), scale));
+      const __m512i hi = avx512F32toS32(_mm512_mul_ps(_mm512_loadu_ps(in+16), scale));
+      _mm256_storeu_si256((__m256i *)(out+0), _mm512_cvtsepi32_epi16(lo));
+      _mm256_storeu_si256((__m256i *)(out+16), _mm512_cvtsepi32_epi16(hi));
+    });
+}
+
+// CS8 <> CF32
+static void avx512CS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const __m512 scale = _mm512_set1_ps(float(scaler/128.0));
+  convertInBlocks<32>(src, dst, numElems*elemDepth, [&scale](const int8_t *in, float *out)
+    {
+      const __m512i lo = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i *)(in+0)));
+      const __m512i hi = _mm512_cvtepi8_epi32(_mm_loadu_si128((const __m128i *)(in+16)));
+      _mm512_storeu_ps(out+0, _mm512_mul_ps(_mm512_cvtepi32_ps(lo), scale));
+      _mm512_storeu_ps(out+16, _mm512_mul_ps(_mm512_cvtepi32_ps(hi), scale));
+    });
+}
+
+static void avx512CF32toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  const __m512 scale = _mm512_set1_ps(float(scaler*128.0));
+  convertInBlocks<32>(src, dst, numElems*elemDepth, [&scale](const float *in, int8_t *out)
+    {
+      const __m512i lo = avx512F32toS32(_mm512_mul_ps(_mm512_loadu_ps(in+0), scale));
+      const __m512i hi = avx512F32toS32(_mm512_mul_ps(_mm512_loadu_ps(in+16), scale));
+      _mm_storeu_si128((__m128i *)(out+0), _mm512_cvtsepi32_epi8(lo));
+      _mm_storeu_si128((__m128i *)(out+16), _mm512_cvtsepi32_epi8(hi));
+    });
+}
+
+// CF32 -> CU8
+static void avx512CF32toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  const __m512 scale = _mm512_set1_ps(float(scaler*128.0));
+  const __m128i offset = _mm_set1_epi8(int8_t(0x80));
+  convertInBlocks<32>(src, dst, numElems*elemDepth, [&](const float *in, uint8_t *out)
+    {
+      const __m512i lo = avx512F32toS32(_mm512_mul_ps(_mm512_loadu_ps(in+0), scale));
+      const __m512i hi = avx512F32toS32(_mm512_mul_ps(_mm512_loadu_ps(in+16), scale));
+      _mm_storeu_si128((__m128i *)(out+0), _mm_xor_si128(_mm512_cvtsepi32_epi8(lo), offset));
+      _mm_storeu_si128((__m128i *)(out+16), _mm_xor_si128(_mm512_cvtsepi32_epi8(hi), offset));
+    });
+}
+
+static const VectorizedConverter avx512Converters[] = {
+  {SOAPY_SDR_CS16, SOAPY_SDR_CF32, &avx512CS16toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS16, &avx512CF32toCS16},
+  {SOAPY_SDR_CS8, SOAPY_SDR_CF32, &avx512CS8toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS8, &avx512CF32toCS8},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CU8, &avx512CF32toCU8},
+};
+
+const VectorizedConverter *getAVX512Converters(size_t &length)
+{
+  length = sizeof(avx512Converters)/sizeof(avx512Converters[0]);
+  return avx512Converters;
+}
+
+#else
+
+const VectorizedConverter *getAVX512Converters(size_t &length)
+{
+  length = 0;
+  return nullptr;
+}
+
+#endif
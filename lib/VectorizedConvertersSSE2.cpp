@@ -0,0 +1,1061 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "VectorizedConverters.hpp"
+#include "ConverterHelpers.hpp"
+#include <SoapySDR/Formats.h>
+#include <stdint.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+
+// ********************************
+// SSE2 Helpers
+
+//convert 4 scaled floats into 4 saturated int32:
+//overflow converts to INT32_MIN, flip it to INT32_MAX for positive inputs
+static inline __m128i sse2F32toS32(const __m128 x)
+{
+  const __m128 overflow = _mm_cmpge_ps(x, _mm_set1_ps(2147483648.0f));
+  return _mm_xor_si128(_mm_cvttps_epi32(x), _mm_castps_si128(overflow));
+}
+
+//unpack 16 complex CS4 elements into 32 left justified int8
+static inline void sse2UnpackCS4(const __m128i x, __m128i &lo, __m128i &hi)
+{
+  const __m128i mask = _mm_set1_epi8(int8_t(0xf0));
+  const __m128i i8 = _mm_and_si128(_mm_slli_epi16(x, 4), mask);
+  const __m128i q8 = _mm_and_si128(x, mask);
+  lo = _mm_unpacklo_epi8(i8, q8);
+  hi = _mm_unpackhi_epi8(i8, q8);
+}
+
+//pack 32 left justified int8 into 16 complex CS4 elements
+static inline __m128i sse2PackCS4(const __m128i lo, const __m128i hi)
+{
+  //each 16-bit lane holds one I/Q pair, move both high nibbles into the low byte
+  const __m128i iMask = _mm_set1_epi16(0x000f);
+  const __m128i qMask = _mm_set1_epi16(0x00f0);
+  const __m128i packLo = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(lo, 4), iMask), _mm_and_si128(_mm_srli_epi16(lo, 8), qMask));
+  const __m128i packHi = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(hi, 4), iMask), _mm_and_si128(_mm_srli_epi16(hi, 8), qMask));
+  return _mm_packus_epi16(packLo, packHi);
+}
+
+//sign extend 16 int8 into 16 scaled floats
+static inline void sse2S8toF32(const __m128i x, float *out, const __m128 scale)
+{
+  const __m128i lo16 = _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+  const __m128i hi16 = _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8);
+  _mm_storeu_ps(out+0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(lo16, lo16), 16)), scale));
+  _mm_storeu_ps(out+4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(lo16, lo16), 16)), scale));
+  _mm_storeu_ps(out+8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(hi16, hi16), 16)), scale));
+  _mm_storeu_ps(out+12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(hi16, hi16), 16)), scale));
+}
+
+//convert 16 scaled floats into 16 saturated int8
+static inline __m128i sse2F32toS8(const float *in, const __m128 scale)
+{
+  const __m128i in0 = sse2F32toS32(_mm_mul_ps(_mm_loadu_ps(in+0), scale));
+  const __m128i in1 = sse2F32toS32(_mm_mul_ps(_mm_loadu_ps(in+4), scale));
+  const __m128i in2 = sse2F32toS32(_mm_mul_ps(_mm_loadu_ps(in+8), scale));
+  const __m128i in3 = sse2F32toS32(_mm_mul_ps(_mm_loadu_ps(in+12), scale));
+  return _mm_packs_epi16(_mm_packs_epi32(in0, in1), _mm_packs_epi32(in2, in3));
+}
+
+//scale 16 int8 through float, truncating like the generic converters
+static inline __m128i sse2ScaleS8(const __m128i x, const __m128 scale)
+{
+  float tmp[16];
+  sse2S8toF32(x, tmp, scale);
+  return sse2F32toS8(tmp, _mm_set1_ps(1.0f));
+}
+
+//scale 8 int16 through float, truncating like the generic converters
+static inline __m128i sse2ScaleS16(const __m128i x, const __m128 scale)
+{
+  const __m128 lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16)), scale);
+  const __m128 hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16)), scale);
+  return _mm_packs_epi32(sse2F32toS32(lo), sse2F32toS32(hi));
+}
+
+//scale 8 int16 by 2^shift, saturating and truncating toward zero like the generic converters
+static inline __m128i sse2ShiftS16(const __m128i x, const int shift)
+{
+  if (shift == 0) return x;
+  if (shift > 0)
+  {
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    const __m128i lo = _mm_sll_epi32(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16), count);
+    const __m128i hi = _mm_sll_epi32(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16), count);
+    return _mm_packs_epi32(lo, hi);
+  }
+  const __m128i bias = _mm_and_si128(_mm_srai_epi16(x, 15), _mm_set1_epi16(int16_t((1 << -shift)-1)));
+  return _mm_sra_epi16(_mm_add_epi16(x, bias), _mm_cvtsi32_si128(-shift));
+}
+
+//scale 16 int8 by 2^shift, saturating and truncating toward zero like the generic converters
+static inline __m128i sse2ShiftS8(const __m128i x, const int shift)
+{
+  if (shift == 0) return x;
+  __m128i lo = _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+  __m128i hi = _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8);
+  if (shift > 0)
+  {
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    return _mm_packs_epi16(_mm_sll_epi16(lo, count), _mm_sll_epi16(hi, count));
+  }
+  const __m128i mask = _mm_set1_epi16(int16_t((1 << -shift)-1));
+  const __m128i count = _mm_cvtsi32_si128(-shift);
+  lo = _mm_sra_epi16(_mm_add_epi16(lo, _mm_and_si128(_mm_srai_epi16(lo, 15), mask)), count);
+  hi = _mm_sra_epi16(_mm_add_epi16(hi, _mm_and_si128(_mm_srai_epi16(hi, 15), mask)), count);
+  return _mm_packs_epi16(lo, hi);
+}
+
+//convert 4 int32 into 4 scaled doubles
+static inline void sse2S32toF64(const __m128i x, double *out, const __m128d scale)
+{
+  _mm_storeu_pd(out+0, _mm_mul_pd(_mm_cvtepi32_pd(x), scale));
+  _mm_storeu_pd(out+2, _mm_mul_pd(_mm_cvtepi32_pd(_mm_srli_si128(x, 8)), scale));
+}
+
+//convert float samples into scaled doubles
+static void sse2WidenF32(const float *src, double *dst, const size_t numSamps, const double scaler)
+{
+  const __m128d scale = _mm_set1_pd(scaler);
+  convertInBlocks<4>(src, dst, numSamps, [&scale](const float *in, double *out)
+    {
+      const __m128 x = _mm_loadu_ps(in);
+      _mm_storeu_pd(out+0, _mm_mul_pd(_mm_cvtps_pd(x), scale));
+      _mm_storeu_pd(out+2, _mm_mul_pd(_mm_cvtps_pd(_mm_movehl_ps(x, x)), scale));
+    });
+}
+
+//convert double samples into scaled floats
+static void sse2NarrowF64(const double *src, float *dst, const size_t numSamps, const double scaler)
+{
+  const __m128d scale = _mm_set1_pd(scaler);
+  convertInBlocks<4>(src, dst, numSamps, [&scale](const double *in, float *out)
+    {
+      const __m128 lo = _mm_cvtpd_ps(_mm_mul_pd(_mm_loadu_pd(in+0), scale));
+      const __m128 hi = _mm_cvtpd_ps(_mm_mul_pd(_mm_loadu_pd(in+2), scale));
+      _mm_storeu_ps(out, _mm_movelh_ps(lo, hi));
+    });
+}
+
+//convert 8 int16 into 8 scaled floats
+static inline void sse2S16toF32(const __m128i x, float *out, const __m128 scale)
+{
+  _mm_storeu_ps(out+0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16)), scale));
+  _mm_storeu_ps(out+4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16)), scale));
+}
+
+//convert 8 scaled floats into 8 saturated int16
+static inline __m128i sse2F32toS16(const float *in, const __m128 scale)
+{
+  const __m128i lo = sse2F32toS32(_mm_mul_ps(_mm_loadu_ps(in+0), scale));
+  const __m128i hi = sse2F32toS32(_mm_mul_ps(_mm_loadu_ps(in+4), scale));
+  return _mm_packs_epi32(lo, hi);
+}
+
+//saturate a scaled float to int16 like the packed conversions, including NaN to -32768
+static inline int16_t sse2SaturateS16(const float x)
+{
+  return int16_t((x > 32767.0f)?32767.0f:((x >= -32768.0f)?x:-32768.0f));
+}
+
+//swap the byte order of 8 int16
+static inline __m128i sse2SwapS16(const __m128i x)
+{
+  return _mm_or_si128(_mm_slli_epi16(x, 8), _mm_srli_epi16(x, 8));
+}
+
+//swap the byte order of 4 int32
+static inline __m128i sse2SwapS32(const __m128i x)
+{
+  return sse2SwapS16(_mm_shufflehi_epi16(_mm_shufflelo_epi16(x, 0xb1), 0xb1));
+}
+
+//sign extend 8 int16 into two vectors of 4 scaled floats
+static inline void sse2S16toF32x2(const __m128i x, const __m128 scale, __m128 &lo, __m128 &hi)
+{
+  lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16)), scale);
+  hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16)), scale);
+}
+
+//power of 4 complex floats held in two vectors: re*re + im*im
+static inline __m128 sse2PowerCF32(const __m128 a, const __m128 b)
+{
+  const __m128 a2 = _mm_mul_ps(a, a);
+  const __m128 b2 = _mm_mul_ps(b, b);
+  return _mm_add_ps(_mm_shuffle_ps(a2, b2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(a2, b2, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+static inline __m128 sse2PowerToPower(const __m128 power)
+{
+  return power;
+}
+
+static inline __m128 sse2PowerToMagnitude(const __m128 power)
+{
+  return _mm_sqrt_ps(power);
+}
+
+//vector form of fastLog2 with the same operation order, scaled to dB
+static inline __m128 sse2PowerToDB(const __m128 power)
+{
+  const __m128i bits = _mm_castps_si128(power);
+  const __m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+  const __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007fffff)), _mm_set1_epi32(0x3f800000)));
+  __m128 poly = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(FAST_LOG2_C3), m), _mm_set1_ps(FAST_LOG2_C2));
+  poly = _mm_add_ps(_mm_mul_ps(poly, m), _mm_set1_ps(FAST_LOG2_C1));
+  poly = _mm_add_ps(_mm_mul_ps(poly, m), _mm_set1_ps(FAST_LOG2_C0));
+  const __m128 log2 = _mm_add_ps(e, _mm_mul_ps(_mm_sub_ps(m, _mm_set1_ps(1.0f)), poly));
+  return _mm_mul_ps(_mm_set1_ps(LOG2_TO_DB), log2);
+}
+
+//transpose a 4x4 matrix of complex CS16 words, its own inverse
+static inline void sse2Transpose4x4(__m128i &r0, __m128i &r1, __m128i &r2, __m128i &r3)
+{
+  const __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+  const __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+  const __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+  const __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+  r0 = _mm_unpacklo_epi64(t0, t1);
+  r1 = _mm_unpackhi_epi64(t0, t1);
+  r2 = _mm_unpacklo_epi64(t2, t3);
+  r3 = _mm_unpackhi_epi64(t2, t3);
+}
+
+//split interleaved CS16 into channels: store(ch, i, x) receives 4 elements of a channel,
+//tail(ch, i, in) receives single elements left over or outside the 1, 2 and 4 channel cases
+template <typename StoreFcn, typename TailFcn>
+static inline void sse2DeinterleaveCS16(const int16_t *src, const size_t numChans, const size_t numElems, const StoreFcn &store, const TailFcn &tail)
+{
+  size_t i = 0;
+  if (numChans == 4) for (; i+4 <= numElems; i += 4)
+    {
+      __m128i r0 = _mm_loadu_si128((const __m128i *)(src+i*8+0));
+      __m128i r1 = _mm_loadu_si128((const __m128i *)(src+i*8+8));
+      __m128i r2 = _mm_loadu_si128((const __m128i *)(src+i*8+16));
+      __m128i r3 = _mm_loadu_si128((const __m128i *)(src+i*8+24));
+      sse2Transpose4x4(r0, r1, r2, r3);
+      store(0, i, r0);
+      store(1, i, r1);
+      store(2, i, r2);
+      store(3, i, r3);
+    }
+  if (numChans == 2) for (; i+4 <= numElems; i += 4)
+    {
+      const __m128i a = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(src+i*4+0)), 0xd8);
+      const __m128i b = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(src+i*4+8)), 0xd8);
+      store(0, i, _mm_unpacklo_epi64(a, b));
+      store(1, i, _mm_unpackhi_epi64(a, b));
+    }
+  if (numChans == 1) for (; i+4 <= numElems; i += 4)
+    {
+      store(0, i, _mm_loadu_si128((const __m128i *)(src+i*2)));
+    }
+  for (; i < numElems; i++)
+    {
+      for (size_t ch = 0; ch < numChans; ch++) tail(ch, i, src+(i*numChans+ch)*2);
+    }
+}
+
+//merge channels into interleaved CS16: load(ch, i) returns 4 elements of a channel,
+//tail(ch, i, out) writes single elements left over or outside the 1, 2 and 4 channel cases
+template <typename LoadFcn, typename TailFcn>
+static inline void sse2InterleaveCS16(int16_t *dst, const size_t numChans, const size_t numElems, const LoadFcn &load, const TailFcn &tail)
+{
+  size_t i = 0;
+  if (numChans == 4) for (; i+4 <= numElems; i += 4)
+    {
+      __m128i r0 = load(0, i);
+      __m128i r1 = load(1, i);
+      __m128i r2 = load(2, i);
+      __m128i r3 = load(3, i);
+      sse2Transpose4x4(r0, r1, r2, r3);
+      _mm_storeu_si128((__m128i *)(dst+i*8+0), r0);
+      _mm_storeu_si128((__m128i *)(dst+i*8+8), r1);
+      _mm_storeu_si128((__m128i *)(dst+i*8+16), r2);
+      _mm_storeu_si128((__m128i *)(dst+i*8+24), r3);
+    }
+  if (numChans == 2) for (; i+4 <= numElems; i += 4)
+    {
+      const __m128i a = load(0, i);
+      const __m128i b = load(1, i);
+      _mm_storeu_si128((__m128i *)(dst+i*4+0), _mm_unpacklo_epi32(a, b));
+      _mm_storeu_si128((__m128i *)(dst+i*4+8), _mm_unpackhi_epi32(a, b));
+    }
+  if (numChans == 1) for (; i+4 <= numElems; i += 4)
+    {
+      _mm_storeu_si128((__m128i *)(dst+i*2), load(0, i));
+    }
+  for (; i < numElems; i++)
+    {
+      for (size_t ch = 0; ch < numChans; ch++) tail(ch, i, dst+(i*numChans+ch)*2);
+    }
+}
+
+// ********************************
+// SSE2 Converters
+
+// CS16 <> CF32
+static void sse2CS16toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler/32768.0));
+  convertInBlocks<8>(src, dst, numElems*elemDepth, [&scale](const int16_t *in, float *out)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)in);
+      const __m128i lo = _mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16);
+      const __m128i hi = _mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16);
+      _mm_storeu_ps(out+0, _mm_mul_ps(_mm_cvtepi32_ps(lo), scale));
+      _mm_storeu_ps(out+4, _mm_mul_ps(_mm_cvtepi32_ps(hi), scale));
+    });
+}
+
+static void sse2CF32toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler*32768.0));
+  convertInBlocks<8>(src, dst, numElems*elemDepth, [&scale](const float *in, int16_t *out)
+    {
+      const __m128i lo = sse2F32toS32(_mm_mul_ps(_mm_loadu_ps(in+0), scale));
+      const __m128i hi = sse2F32toS32(_mm_mul_ps(_mm_loadu_ps(in+4), scale));
+      _mm_storeu_si128((__m128i *)out, _mm_packs_epi32(lo, hi));
+    });
+}
+
+// CS8 <> CF32
+static void sse2CS8toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler/128.0));
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&scale](const int8_t *in, float *out)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)in);
+      const __m128i lo16 = _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+      const __m128i hi16 = _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8);
+      _mm_storeu_ps(out+0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(lo16, lo16), 16)), scale));
+      _mm_storeu_ps(out+4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(lo16, lo16), 16)), scale));
+      _mm_storeu_ps(out+8, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(hi16, hi16), 16)), scale));
+      _mm_storeu_ps(out+12, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(hi16, hi16), 16)), scale));
+    });
+}
+
+static void sse2CF32toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler*128.0));
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&scale](const float *in, int8_t *out)
+    {
+      _mm_storeu_si128((__m128i *)out, sse2F32toS8(in, scale));
+    });
+}
+
+// CF32 -> CU8
+static void sse2CF32toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler*128.0));
+  const __m128i offset = _mm_set1_epi8(int8_t(0x80));
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&](const float *in, uint8_t *out)
+    {
+      _mm_storeu_si128((__m128i *)out, _mm_xor_si128(sse2F32toS8(in, scale), offset));
+    });
+}
+
+// CS4 -> CS8
+static void sse2CS4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<16, 1, 2, 16>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      __m128i lo, hi;
+      sse2UnpackCS4(_mm_loadu_si128((const __m128i *)in), lo, hi);
+      _mm_storeu_si128((__m128i *)(out+0), unity?lo:sse2ScaleS8(lo, scale));
+      _mm_storeu_si128((__m128i *)(out+16), unity?hi:sse2ScaleS8(hi, scale));
+    });
+}
+
+// CS4 -> CS16
+static void sse2CS4toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<16, 1, 4, 16>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      __m128i lo, hi;
+      sse2UnpackCS4(_mm_loadu_si128((const __m128i *)in), lo, hi);
+      const __m128i zero = _mm_setzero_si128();
+      const __m128i s16[4] = {
+        _mm_unpacklo_epi8(zero, lo), _mm_unpackhi_epi8(zero, lo),
+        _mm_unpacklo_epi8(zero, hi), _mm_unpackhi_epi8(zero, hi)};
+      for (size_t j = 0; j < 4; j++)
+        {
+          _mm_storeu_si128((__m128i *)(out+j*16), unity?s16[j]:sse2ScaleS16(s16[j], scale));
+        }
+    });
+}
+
+// CS4 <> CF32
+static void sse2CS4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler/128.0));
+  convertPackedInBlocks<16, 1, 8, 16>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      __m128i lo, hi;
+      sse2UnpackCS4(_mm_loadu_si128((const __m128i *)in), lo, hi);
+      sse2S8toF32(lo, (float *)out+0, scale);
+      sse2S8toF32(hi, (float *)out+16, scale);
+    });
+}
+
+static void sse2CF32toCS4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler*128.0));
+  convertPackedInBlocks<16, 8, 1, 128>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      const __m128i lo = sse2F32toS8((const float *)in+0, scale);
+      const __m128i hi = sse2F32toS8((const float *)in+16, scale);
+      _mm_storeu_si128((__m128i *)out, sse2PackCS4(lo, hi));
+    });
+}
+
+// CU4 -> CS8
+static void sse2CU4toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const __m128i offset = _mm_set1_epi8(int8_t(0x80));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<16, 1, 2, 16>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      __m128i lo, hi;
+      sse2UnpackCS4(_mm_loadu_si128((const __m128i *)in), lo, hi);
+      lo = _mm_xor_si128(lo, offset);
+      hi = _mm_xor_si128(hi, offset);
+      _mm_storeu_si128((__m128i *)(out+0), unity?lo:sse2ScaleS8(lo, scale));
+      _mm_storeu_si128((__m128i *)(out+16), unity?hi:sse2ScaleS8(hi, scale));
+    });
+}
+
+// CU4 -> CS16
+static void sse2CU4toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const __m128i offset = _mm_set1_epi8(int8_t(0x80));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<16, 1, 4, 16>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      __m128i lo, hi;
+      sse2UnpackCS4(_mm_loadu_si128((const __m128i *)in), lo, hi);
+      lo = _mm_xor_si128(lo, offset);
+      hi = _mm_xor_si128(hi, offset);
+      const __m128i zero = _mm_setzero_si128();
+      const __m128i s16[4] = {
+        _mm_unpacklo_epi8(zero, lo), _mm_unpackhi_epi8(zero, lo),
+        _mm_unpacklo_epi8(zero, hi), _mm_unpackhi_epi8(zero, hi)};
+      for (size_t j = 0; j < 4; j++)
+        {
+          _mm_storeu_si128((__m128i *)(out+j*16), unity?s16[j]:sse2ScaleS16(s16[j], scale));
+        }
+    });
+}
+
+// CU4 <> CF32
+static void sse2CU4toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler/128.0));
+  const __m128i offset = _mm_set1_epi8(int8_t(0x80));
+  convertPackedInBlocks<16, 1, 8, 16>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      __m128i lo, hi;
+      sse2UnpackCS4(_mm_loadu_si128((const __m128i *)in), lo, hi);
+      lo = _mm_xor_si128(lo, offset);
+      hi = _mm_xor_si128(hi, offset);
+      sse2S8toF32(lo, (float *)out+0, scale);
+      sse2S8toF32(hi, (float *)out+16, scale);
+    });
+}
+
+static void sse2CF32toCU4(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler*128.0));
+  const __m128i offset = _mm_set1_epi8(int8_t(0x80));
+  convertPackedInBlocks<16, 8, 1, 128>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      const __m128i lo = sse2F32toS8((const float *)in+0, scale);
+      const __m128i hi = sse2F32toS8((const float *)in+16, scale);
+      _mm_storeu_si128((__m128i *)out, sse2PackCS4(_mm_xor_si128(lo, offset), _mm_xor_si128(hi, offset)));
+    });
+}
+
+// F32 <> F64
+static void sse2F32toF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2WidenF32((const float*)srcBuff, (double*)dstBuff, numElems, scaler);
+}
+
+static void sse2F64toF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  sse2NarrowF64((const double*)srcBuff, (float*)dstBuff, numElems, scaler);
+}
+
+// CF32 <> CF64
+static void sse2CF32toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2WidenF32((const float*)srcBuff, (double*)dstBuff, numElems*elemDepth, scaler);
+}
+
+static void sse2CF64toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+  sse2NarrowF64((const double*)srcBuff, (float*)dstBuff, numElems*elemDepth, scaler);
+}
+
+// CS16 -> CF64
+static void sse2CS16toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  const __m128d scale = _mm_set1_pd(scaler/32768.0);
+  convertInBlocks<8>(src, dst, numElems*elemDepth, [&scale](const int16_t *in, double *out)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)in);
+      sse2S32toF64(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16), out+0, scale);
+      sse2S32toF64(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16), out+4, scale);
+    });
+}
+
+// CS8 -> CF64
+static void sse2CS8toCF64(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (double*)dstBuff;
+  const __m128d scale = _mm_set1_pd(scaler/128.0);
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&scale](const int8_t *in, double *out)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)in);
+      const __m128i lo16 = _mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8);
+      const __m128i hi16 = _mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8);
+      sse2S32toF64(_mm_srai_epi32(_mm_unpacklo_epi16(lo16, lo16), 16), out+0, scale);
+      sse2S32toF64(_mm_srai_epi32(_mm_unpackhi_epi16(lo16, lo16), 16), out+4, scale);
+      sse2S32toF64(_mm_srai_epi32(_mm_unpacklo_epi16(hi16, hi16), 16), out+8, scale);
+      sse2S32toF64(_mm_srai_epi32(_mm_unpackhi_epi16(hi16, hi16), 16), out+12, scale);
+    });
+}
+
+// CS16 <> CS8
+static void sse2CS16toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  int shift = 0;
+  const bool exact = scalerToShift(scaler, 15, shift);
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&](const int16_t *in, int8_t *out)
+    {
+      const __m128i lo = _mm_loadu_si128((const __m128i *)(in+0));
+      const __m128i hi = _mm_loadu_si128((const __m128i *)(in+8));
+      const __m128i scaledLo = exact?sse2ShiftS16(lo, shift):sse2ScaleS16(lo, scale);
+      const __m128i scaledHi = exact?sse2ShiftS16(hi, shift):sse2ScaleS16(hi, scale);
+      _mm_storeu_si128((__m128i *)out, _mm_packs_epi16(_mm_srai_epi16(scaledLo, 8), _mm_srai_epi16(scaledHi, 8)));
+    });
+}
+
+static void sse2CS8toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  int shift = 0;
+  const bool exact = scalerToShift(scaler, 15, shift);
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&](const int8_t *in, int16_t *out)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)in);
+      const __m128i lo = _mm_unpacklo_epi8(_mm_setzero_si128(), x);
+      const __m128i hi = _mm_unpackhi_epi8(_mm_setzero_si128(), x);
+      _mm_storeu_si128((__m128i *)(out+0), exact?sse2ShiftS16(lo, shift):sse2ScaleS16(lo, scale));
+      _mm_storeu_si128((__m128i *)(out+8), exact?sse2ShiftS16(hi, shift):sse2ScaleS16(hi, scale));
+    });
+}
+
+// CS16 <> CU16
+static void sse2CS16toCU16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (uint16_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const __m128i offset = _mm_set1_epi16(int16_t(0x8000));
+  int shift = 0;
+  const bool exact = scalerToShift(scaler, 15, shift);
+  convertInBlocks<8>(src, dst, numElems*elemDepth, [&](const int16_t *in, uint16_t *out)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)in);
+      _mm_storeu_si128((__m128i *)out, _mm_xor_si128(exact?sse2ShiftS16(x, shift):sse2ScaleS16(x, scale), offset));
+    });
+}
+
+static void sse2CU16toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const uint16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const __m128i offset = _mm_set1_epi16(int16_t(0x8000));
+  int shift = 0;
+  const bool exact = scalerToShift(scaler, 15, shift);
+  convertInBlocks<8>(src, dst, numElems*elemDepth, [&](const uint16_t *in, int16_t *out)
+    {
+      const __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in), offset);
+      _mm_storeu_si128((__m128i *)out, exact?sse2ShiftS16(x, shift):sse2ScaleS16(x, scale));
+    });
+}
+
+// CS8 <> CU8
+static void sse2CS8toCU8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int8_t*)srcBuff;
+  auto *dst = (uint8_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const __m128i offset = _mm_set1_epi8(int8_t(0x80));
+  int shift = 0;
+  const bool exact = scalerToShift(scaler, 7, shift);
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&](const int8_t *in, uint8_t *out)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)in);
+      _mm_storeu_si128((__m128i *)out, _mm_xor_si128(exact?sse2ShiftS8(x, shift):sse2ScaleS8(x, scale), offset));
+    });
+}
+
+static void sse2CU8toCS8(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const uint8_t*)srcBuff;
+  auto *dst = (int8_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const __m128i offset = _mm_set1_epi8(int8_t(0x80));
+  int shift = 0;
+  const bool exact = scalerToShift(scaler, 7, shift);
+  convertInBlocks<16>(src, dst, numElems*elemDepth, [&](const uint8_t *in, int8_t *out)
+    {
+      const __m128i x = _mm_xor_si128(_mm_loadu_si128((const __m128i *)in), offset);
+      _mm_storeu_si128((__m128i *)out, exact?sse2ShiftS8(x, shift):sse2ScaleS8(x, scale));
+    });
+}
+
+// CS16BE <> CS16
+static void sse2CS16BEtoCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  int shift = 0;
+  const bool exact = scalerToShift(scaler, 15, shift);
+  convertInBlocks<8>(src, dst, numElems*elemDepth, [&](const int16_t *in, int16_t *out)
+    {
+      const __m128i x = sse2SwapS16(_mm_loadu_si128((const __m128i *)in));
+      _mm_storeu_si128((__m128i *)out, exact?sse2ShiftS16(x, shift):sse2ScaleS16(x, scale));
+    });
+}
+
+static void sse2CS16toCS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  int shift = 0;
+  const bool exact = scalerToShift(scaler, 15, shift);
+  convertInBlocks<8>(src, dst, numElems*elemDepth, [&](const int16_t *in, int16_t *out)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)in);
+      _mm_storeu_si128((__m128i *)out, sse2SwapS16(exact?sse2ShiftS16(x, shift):sse2ScaleS16(x, scale)));
+    });
+}
+
+// CS16BE <> CF32
+static void sse2CS16BEtoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int16_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler/32768.0));
+  convertInBlocks<8>(src, dst, numElems*elemDepth, [&scale](const int16_t *in, float *out)
+    {
+      sse2S16toF32(sse2SwapS16(_mm_loadu_si128((const __m128i *)in)), out, scale);
+    });
+}
+
+static void sse2CF32toCS16BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int16_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler*32768.0));
+  convertInBlocks<8>(src, dst, numElems*elemDepth, [&scale](const float *in, int16_t *out)
+    {
+      _mm_storeu_si128((__m128i *)out, sse2SwapS16(sse2F32toS16(in, scale)));
+    });
+}
+
+// CS32BE <> CF32
+static void sse2CS32BEtoCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const int32_t*)srcBuff;
+  auto *dst = (float*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler/2147483648.0));
+  convertInBlocks<4>(src, dst, numElems*elemDepth, [&scale](const int32_t *in, float *out)
+    {
+      const __m128i x = sse2SwapS32(_mm_loadu_si128((const __m128i *)in));
+      _mm_storeu_ps(out, _mm_mul_ps(_mm_cvtepi32_ps(x), scale));
+    });
+}
+
+static void sse2CF32toCS32BE(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const size_t elemDepth = 2;
+
+  auto *src = (const float*)srcBuff;
+  auto *dst = (int32_t*)dstBuff;
+  const __m128 scale = _mm_set1_ps(float(scaler*2147483648.0));
+  convertInBlocks<4>(src, dst, numElems*elemDepth, [&scale](const float *in, int32_t *out)
+    {
+      const __m128i x = sse2F32toS32(_mm_mul_ps(_mm_loadu_ps(in), scale));
+      _mm_storeu_si128((__m128i *)out, sse2SwapS32(x));
+    });
+}
+
+// CF32 -> F32POW/F32MAG/F32DB
+template <__m128 (*Finish)(const __m128)>
+static void sse2CF32toPower(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  convertPackedInBlocks<4, 8, 4, 32>(srcBuff, dstBuff, numElems, [&scale](const unsigned char *in, unsigned char *out)
+    {
+      const __m128 a = _mm_mul_ps(_mm_loadu_ps((const float *)in+0), scale);
+      const __m128 b = _mm_mul_ps(_mm_loadu_ps((const float *)in+4), scale);
+      _mm_storeu_ps((float *)out, Finish(sse2PowerCF32(a, b)));
+    });
+}
+
+// CS16 -> F32POW/F32MAG/F32DB
+template <__m128 (*Finish)(const __m128)>
+static void sse2CS16toPower(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler/32768.0));
+  convertPackedInBlocks<4, 4, 4, 16>(srcBuff, dstBuff, numElems, [&scale](const unsigned char *in, unsigned char *out)
+    {
+      __m128 a, b;
+      sse2S16toF32x2(_mm_loadu_si128((const __m128i *)in), scale, a, b);
+      _mm_storeu_ps((float *)out, Finish(sse2PowerCF32(a, b)));
+    });
+}
+
+// CS8 -> F32POW/F32MAG/F32DB
+template <__m128 (*Finish)(const __m128)>
+static void sse2CS8toPower(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler/128.0));
+  convertPackedInBlocks<8, 2, 4, 16>(srcBuff, dstBuff, numElems, [&scale](const unsigned char *in, unsigned char *out)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)in);
+      __m128 a, b, c, d;
+      sse2S16toF32x2(_mm_srai_epi16(_mm_unpacklo_epi8(x, x), 8), scale, a, b);
+      sse2S16toF32x2(_mm_srai_epi16(_mm_unpackhi_epi8(x, x), 8), scale, c, d);
+      _mm_storeu_ps((float *)out+0, Finish(sse2PowerCF32(a, b)));
+      _mm_storeu_ps((float *)out+4, Finish(sse2PowerCF32(c, d)));
+    });
+}
+
+// CS16/CS8/CU8 -> CF32 (decimate)
+//
+// The CIC filter keeps I and Q in the two 64 bit lanes of each stage,
+// so an input element costs one load and one add per integrator.
+
+//sign extend the I and Q samples in the low two 32 bit lanes to 64 bit lanes
+static inline __m128i sse2S32x2toS64(const __m128i x)
+{
+  return _mm_unpacklo_epi32(x, _mm_srai_epi32(x, 31));
+}
+
+static inline __m128i sse2LoadCS16toS64(const unsigned char *in)
+{
+  int32_t iq;
+  std::memcpy(&iq, in, sizeof(iq));
+  const __m128i x = _mm_cvtsi32_si128(iq);
+  return sse2S32x2toS64(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16));
+}
+
+static inline __m128i sse2S8x2toS64(const __m128i x)
+{
+  const __m128i x16 = _mm_unpacklo_epi8(x, x);
+  return sse2S32x2toS64(_mm_srai_epi32(_mm_unpacklo_epi16(x16, x16), 24));
+}
+
+static inline __m128i sse2LoadCS8toS64(const unsigned char *in)
+{
+  return sse2S8x2toS64(_mm_cvtsi32_si128(in[0] | (in[1] << 8)));
+}
+
+static inline __m128i sse2LoadCU8toS64(const unsigned char *in)
+{
+  return sse2S8x2toS64(_mm_cvtsi32_si128((in[0] | (in[1] << 8)) ^ 0x8080));
+}
+
+template <size_t InElemSize, int InputBits, __m128i (*Load)(const unsigned char *)>
+static size_t sse2DecimateToCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const size_t factor, SoapySDR::ConverterRegistry::DecimateState &state, const double scaler)
+{
+  const size_t order = SoapySDR::ConverterRegistry::DECIMATE_ORDER;
+  auto *in = (const unsigned char *)srcBuff;
+  auto *out = (float *)dstBuff;
+  const double norm = decimateNorm(factor, order, InputBits, scaler);
+
+  __m128i integrators[order], combs[order];
+  for (size_t k = 0; k < order; k++)
+  {
+    integrators[k] = _mm_loadu_si128((const __m128i *)(state.integrators+k*2));
+    combs[k] = _mm_loadu_si128((const __m128i *)(state.combs+k*2));
+  }
+
+  size_t phase = state.phase;
+  size_t numOut = 0;
+  for (size_t i = 0; i < numElems; i++)
+  {
+    __m128i x = Load(in+i*InElemSize);
+    for (size_t k = 0; k < order; k++) x = integrators[k] = _mm_add_epi64(integrators[k], x);
+    if (++phase < factor) continue;
+    phase = 0;
+
+    for (size_t k = 0; k < order; k++)
+    {
+      const __m128i y = _mm_sub_epi64(x, combs[k]);
+      combs[k] = x;
+      x = y;
+    }
+    int64_t iq[2];
+    _mm_storeu_si128((__m128i *)iq, x);
+    out[numOut*2+0] = float(double(iq[0])*norm);
+    out[numOut*2+1] = float(double(iq[1])*norm);
+    numOut++;
+  }
+
+  for (size_t k = 0; k < order; k++)
+  {
+    _mm_storeu_si128((__m128i *)(state.integrators+k*2), integrators[k]);
+    _mm_storeu_si128((__m128i *)(state.combs+k*2), combs[k]);
+  }
+  state.phase = phase;
+  return numOut;
+}
+
+static const VectorizedConverter sse2Converters[] = {
+  {SOAPY_SDR_CS16, SOAPY_SDR_CF32, &sse2CS16toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS16, &sse2CF32toCS16},
+  {SOAPY_SDR_CS8, SOAPY_SDR_CF32, &sse2CS8toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS8, &sse2CF32toCS8},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CU8, &sse2CF32toCU8},
+  {SOAPY_SDR_CS4, SOAPY_SDR_CS8, &sse2CS4toCS8},
+  {SOAPY_SDR_CS4, SOAPY_SDR_CS16, &sse2CS4toCS16},
+  {SOAPY_SDR_CS4, SOAPY_SDR_CF32, &sse2CS4toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS4, &sse2CF32toCS4},
+  {SOAPY_SDR_CU4, SOAPY_SDR_CS8, &sse2CU4toCS8},
+  {SOAPY_SDR_CU4, SOAPY_SDR_CS16, &sse2CU4toCS16},
+  {SOAPY_SDR_CU4, SOAPY_SDR_CF32, &sse2CU4toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CU4, &sse2CF32toCU4},
+  {SOAPY_SDR_F32, SOAPY_SDR_F64, &sse2F32toF64},
+  {SOAPY_SDR_F64, SOAPY_SDR_F32, &sse2F64toF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CF64, &sse2CF32toCF64},
+  {SOAPY_SDR_CF64, SOAPY_SDR_CF32, &sse2CF64toCF32},
+  {SOAPY_SDR_CS16, SOAPY_SDR_CF64, &sse2CS16toCF64},
+  {SOAPY_SDR_CS8, SOAPY_SDR_CF64, &sse2CS8toCF64},
+  {SOAPY_SDR_CS16, SOAPY_SDR_CS8, &sse2CS16toCS8},
+  {SOAPY_SDR_CS8, SOAPY_SDR_CS16, &sse2CS8toCS16},
+  {SOAPY_SDR_CS16, SOAPY_SDR_CU16, &sse2CS16toCU16},
+  {SOAPY_SDR_CU16, SOAPY_SDR_CS16, &sse2CU16toCS16},
+  {SOAPY_SDR_CS8, SOAPY_SDR_CU8, &sse2CS8toCU8},
+  {SOAPY_SDR_CU8, SOAPY_SDR_CS8, &sse2CU8toCS8},
+  {SOAPY_SDR_CS16BE, SOAPY_SDR_CS16, &sse2CS16BEtoCS16},
+  {SOAPY_SDR_CS16, SOAPY_SDR_CS16BE, &sse2CS16toCS16BE},
+  {SOAPY_SDR_CS16BE, SOAPY_SDR_CF32, &sse2CS16BEtoCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS16BE, &sse2CF32toCS16BE},
+  {SOAPY_SDR_CS32BE, SOAPY_SDR_CF32, &sse2CS32BEtoCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS32BE, &sse2CF32toCS32BE},
+  {SOAPY_SDR_CF32, SOAPY_SDR_F32POW, &sse2CF32toPower<sse2PowerToPower>},
+  {SOAPY_SDR_CF32, SOAPY_SDR_F32MAG, &sse2CF32toPower<sse2PowerToMagnitude>},
+  {SOAPY_SDR_CF32, SOAPY_SDR_F32DB, &sse2CF32toPower<sse2PowerToDB>},
+  {SOAPY_SDR_CS16, SOAPY_SDR_F32POW, &sse2CS16toPower<sse2PowerToPower>},
+  {SOAPY_SDR_CS16, SOAPY_SDR_F32MAG, &sse2CS16toPower<sse2PowerToMagnitude>},
+  {SOAPY_SDR_CS16, SOAPY_SDR_F32DB, &sse2CS16toPower<sse2PowerToDB>},
+  {SOAPY_SDR_CS8, SOAPY_SDR_F32POW, &sse2CS8toPower<sse2PowerToPower>},
+  {SOAPY_SDR_CS8, SOAPY_SDR_F32MAG, &sse2CS8toPower<sse2PowerToMagnitude>},
+  {SOAPY_SDR_CS8, SOAPY_SDR_F32DB, &sse2CS8toPower<sse2PowerToDB>},
+};
+
+// CS16 -> CS16 (deinterleave)
+static void sse2DeinterleaveCS16toCS16(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+  //the tail saturates like the packs of the body
+  const float scaleF = float(scaler);
+  const __m128 scale = _mm_set1_ps(scaleF);
+  const bool unity = (scaler == 1.0);
+  sse2DeinterleaveCS16((const int16_t*)srcBuff, numChans, numElems,
+    [&](const size_t ch, const size_t i, const __m128i x)
+    {
+      _mm_storeu_si128((__m128i *)((int16_t *)dstBuffs[ch]+i*2), unity?x:sse2ScaleS16(x, scale));
+    },
+    [&](const size_t ch, const size_t i, const int16_t *in)
+    {
+      auto *out = (int16_t *)dstBuffs[ch]+i*2;
+      out[0] = sse2SaturateS16(float(in[0])*scaleF);
+      out[1] = sse2SaturateS16(float(in[1])*scaleF);
+    });
+}
+
+// CS16 -> CF32 (deinterleave)
+static void sse2DeinterleaveCS16toCF32(const void *srcBuff, void * const *dstBuffs, const size_t numChans, const size_t numElems, const double scaler)
+{
+  const float scaleF = float(scaler/32768.0);
+  const __m128 scale = _mm_set1_ps(scaleF);
+  sse2DeinterleaveCS16((const int16_t*)srcBuff, numChans, numElems,
+    [&](const size_t ch, const size_t i, const __m128i x)
+    {
+      sse2S16toF32(x, (float *)dstBuffs[ch]+i*2, scale);
+    },
+    [&](const size_t ch, const size_t i, const int16_t *in)
+    {
+      auto *out = (float *)dstBuffs[ch]+i*2;
+      out[0] = float(in[0])*scaleF;
+      out[1] = float(in[1])*scaleF;
+    });
+}
+
+// CS16 -> CS16 (interleave)
+static void sse2InterleaveCS16toCS16(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
+{
+  //the tail saturates like the packs of the body
+  const float scaleF = float(scaler);
+  const __m128 scale = _mm_set1_ps(scaleF);
+  const bool unity = (scaler == 1.0);
+  sse2InterleaveCS16((int16_t*)dstBuff, numChans, numElems,
+    [&](const size_t ch, const size_t i)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)((const int16_t *)srcBuffs[ch]+i*2));
+      return unity?x:sse2ScaleS16(x, scale);
+    },
+    [&](const size_t ch, const size_t i, int16_t *out)
+    {
+      auto *in = (const int16_t *)srcBuffs[ch]+i*2;
+      out[0] = sse2SaturateS16(float(in[0])*scaleF);
+      out[1] = sse2SaturateS16(float(in[1])*scaleF);
+    });
+}
+
+// CF32 -> CS16 (interleave)
+static void sse2InterleaveCF32toCS16(const void * const *srcBuffs, void *dstBuff, const size_t numChans, const size_t numElems, const double scaler)
+{
+  const float scaleF = float(scaler*32768.0);
+  const __m128 scale = _mm_set1_ps(scaleF);
+  sse2InterleaveCS16((int16_t*)dstBuff, numChans, numElems,
+    [&](const size_t ch, const size_t i)
+    {
+      return sse2F32toS16((const float *)srcBuffs[ch]+i*2, scale);
+    },
+    [&](const size_t ch, const size_t i, int16_t *out)
+    {
+      auto *in = (const float *)srcBuffs[ch]+i*2;
+      out[0] = sse2SaturateS16(in[0]*scaleF);
+      out[1] = sse2SaturateS16(in[1]*scaleF);
+    });
+}
+
+static const VectorizedLayoutConverter sse2LayoutConverters[] = {
+  {SOAPY_SDR_CS16, SOAPY_SDR_CS16, &sse2DeinterleaveCS16toCS16, nullptr},
+  {SOAPY_SDR_CS16, SOAPY_SDR_CF32, &sse2DeinterleaveCS16toCF32, nullptr},
+  {SOAPY_SDR_CS16, SOAPY_SDR_CS16, nullptr, &sse2InterleaveCS16toCS16},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS16, nullptr, &sse2InterleaveCF32toCS16},
+};
+
+static const VectorizedDecimator sse2Decimators[] = {
+  {SOAPY_SDR_CS16, SOAPY_SDR_CF32, &sse2DecimateToCF32<4, 15, sse2LoadCS16toS64>},
+  {SOAPY_SDR_CS8, SOAPY_SDR_CF32, &sse2DecimateToCF32<2, 7, sse2LoadCS8toS64>},
+  {SOAPY_SDR_CU8, SOAPY_SDR_CF32, &sse2DecimateToCF32<2, 7, sse2LoadCU8toS64>},
+};
+
+const VectorizedConverter *getSSE2Converters(size_t &length)
+{
+  length = sizeof(sse2Converters)/sizeof(sse2Converters[0]);
+  return sse2Converters;
+}
+
+const VectorizedLayoutConverter *getSSE2LayoutConverters(size_t &length)
+{
+  length = sizeof(sse2LayoutConverters)/sizeof(sse2LayoutConverters[0]);
+  return sse2LayoutConverters;
+}
+
+const VectorizedDecimator *getSSE2Decimators(size_t &length)
+{
+  length = sizeof(sse2Decimators)/sizeof(sse2Decimators[0]);
+  return sse2Decimators;
+}
+
+#else
+
+const VectorizedConverter *getSSE2Converters(size_t &length)
+{
+  length = 0;
+  return nullptr;
+}
+
+const VectorizedLayoutConverter *getSSE2LayoutConverters(size_t &length)
+{
+  length = 0;
+  return nullptr;
+}
+
+const VectorizedDecimator *getSSE2Decimators(size_t &length)
+{
+  length = 0;
+  return nullptr;
+}
+
+#endif
@@ -0,0 +1,183 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include "VectorizedConverters.hpp"
+#include <SoapySDR/Formats.h>
+#include <stdint.h>
+
+#if defined(__SSSE3__) || (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86)))
+#include <tmmintrin.h>
+
+// ********************************
+// SSSE3 Helpers
+
+//unpack 4 complex CS12 elements (12 of 16 loaded bytes) into 8 left justified int16
+static inline __m128i ssse3UnpackCS12(const unsigned char *in)
+{
+  const __m128i shuffle = _mm_setr_epi8(0, 1, 1, 2, 3, 4, 4, 5, 6, 7, 7, 8, 9, 10, 10, 11);
+  const __m128i x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)in), shuffle);
+  const __m128i i16 = _mm_and_si128(_mm_slli_epi16(x, 4), _mm_set1_epi32(0x0000ffff));
+  const __m128i q16 = _mm_and_si128(x, _mm_set1_epi32(int(0xfff00000)));
+  return _mm_or_si128(i16, q16);
+}
+
+//pack 8 left justified int16 into 4 complex CS12 elements (12 bytes)
+static inline void ssse3PackCS12(const __m128i x, unsigned char *out)
+{
+  const __m128i i12 = _mm_srli_epi32(_mm_and_si128(x, _mm_set1_epi32(0x0000fff0)), 4);
+  const __m128i q12 = _mm_srli_epi32(_mm_and_si128(x, _mm_set1_epi32(int(0xfff00000))), 8);
+  const __m128i shuffle = _mm_setr_epi8(0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+  const __m128i packed = _mm_shuffle_epi8(_mm_or_si128(i12, q12), shuffle);
+  const int top = _mm_cvtsi128_si32(_mm_srli_si128(packed, 8));
+  _mm_storel_epi64((__m128i *)out, packed);
+  std::memcpy(out+8, &top, sizeof(top));
+}
+
+//convert 8 int16 into 8 scaled floats
+static inline void ssse3S16toF32(const __m128i x, float *out, const __m128 scale)
+{
+  _mm_storeu_ps(out+0, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16)), scale));
+  _mm_storeu_ps(out+4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16)), scale));
+}
+
+//convert 4 scaled floats into 4 saturated int32:
+//overflow converts to INT32_MIN, flip it to INT32_MAX for positive inputs
+static inline __m128i ssse3F32toS32(const __m128 x)
+{
+  const __m128 overflow = _mm_cmpge_ps(x, _mm_set1_ps(2147483648.0f));
+  return _mm_xor_si128(_mm_cvttps_epi32(x), _mm_castps_si128(overflow));
+}
+
+//convert 8 scaled floats into 8 saturated int16
+static inline __m128i ssse3F32toS16(const float *in, const __m128 scale)
+{
+  const __m128i lo = ssse3F32toS32(_mm_mul_ps(_mm_loadu_ps(in+0), scale));
+  const __m128i hi = ssse3F32toS32(_mm_mul_ps(_mm_loadu_ps(in+4), scale));
+  return _mm_packs_epi32(lo, hi);
+}
+
+//scale 8 int16 through float, truncating like the generic converters
+static inline __m128i ssse3ScaleS16(const __m128i x, const __m128 scale)
+{
+  const __m128 lo = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(x, x), 16)), scale);
+  const __m128 hi = _mm_mul_ps(_mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(x, x), 16)), scale);
+  return _mm_packs_epi32(ssse3F32toS32(lo), ssse3F32toS32(hi));
+}
+
+// ********************************
+// SSSE3 Converters
+
+// CS12 <> CS16
+static void ssse3CS12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<4, 3, 4, 16>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      const __m128i x = ssse3UnpackCS12(in);
+      _mm_storeu_si128((__m128i *)out, unity?x:ssse3ScaleS16(x, scale));
+    });
+}
+
+static void ssse3CS16toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<4, 4, 3, 16>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)in);
+      ssse3PackCS12(unity?x:ssse3ScaleS16(x, scale), out);
+    });
+}
+
+// CS12 <> CF32
+static void ssse3CS12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler/32768.0));
+  convertPackedInBlocks<4, 3, 8, 16>(srcBuff, dstBuff, numElems, [&scale](const unsigned char *in, unsigned char *out)
+    {
+      ssse3S16toF32(ssse3UnpackCS12(in), (float *)out, scale);
+    });
+}
+
+static void ssse3CF32toCS12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler*32768.0));
+  convertPackedInBlocks<4, 8, 3, 32>(srcBuff, dstBuff, numElems, [&scale](const unsigned char *in, unsigned char *out)
+    {
+      ssse3PackCS12(ssse3F32toS16((const float *)in, scale), out);
+    });
+}
+
+// CU12 <> CS16
+static void ssse3CU12toCS16(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const __m128i offset = _mm_set1_epi16(int16_t(0x8000));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<4, 3, 4, 16>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      const __m128i x = _mm_xor_si128(ssse3UnpackCS12(in), offset);
+      _mm_storeu_si128((__m128i *)out, unity?x:ssse3ScaleS16(x, scale));
+    });
+}
+
+static void ssse3CS16toCU12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler));
+  const __m128i offset = _mm_set1_epi16(int16_t(0x8000));
+  const bool unity = (scaler == 1.0);
+  convertPackedInBlocks<4, 4, 3, 16>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      const __m128i x = _mm_loadu_si128((const __m128i *)in);
+      ssse3PackCS12(_mm_xor_si128(unity?x:ssse3ScaleS16(x, scale), offset), out);
+    });
+}
+
+// CU12 <> CF32
+static void ssse3CU12toCF32(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler/32768.0));
+  const __m128i offset = _mm_set1_epi16(int16_t(0x8000));
+  convertPackedInBlocks<4, 3, 8, 16>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      ssse3S16toF32(_mm_xor_si128(ssse3UnpackCS12(in), offset), (float *)out, scale);
+    });
+}
+
+static void ssse3CF32toCU12(const void *srcBuff, void *dstBuff, const size_t numElems, const double scaler)
+{
+  const __m128 scale = _mm_set1_ps(float(scaler*32768.0));
+  const __m128i offset = _mm_set1_epi16(int16_t(0x8000));
+  convertPackedInBlocks<4, 8, 3, 32>(srcBuff, dstBuff, numElems, [&](const unsigned char *in, unsigned char *out)
+    {
+      ssse3PackCS12(_mm_xor_si128(ssse3F32toS16((const float *)in, scale), offset), out);
+    });
+}
+
+static const VectorizedConverter ssse3Converters[] = {
+  {SOAPY_SDR_CS12, SOAPY_SDR_CS16, &ssse3CS12toCS16},
+  {SOAPY_SDR_CS16, SOAPY_SDR_CS12, &ssse3CS16toCS12},
+  {SOAPY_SDR_CS12, SOAPY_SDR_CF32, &ssse3CS12toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CS12, &ssse3CF32toCS12},
+  {SOAPY_SDR_CU12, SOAPY_SDR_CS16, &ssse3CU12toCS16},
+  {SOAPY_SDR_CS16, SOAPY_SDR_CU12, &ssse3CS16toCU12},
+  {SOAPY_SDR_CU12, SOAPY_SDR_CF32, &ssse3CU12toCF32},
+  {SOAPY_SDR_CF32, SOAPY_SDR_CU12, &ssse3CF32toCU12},
+};
+
+const VectorizedConverter *getSSSE3Converters(size_t &length)
+{
+  length = sizeof(ssse3Converters)/sizeof(ssse3Converters[0]);
+  return ssse3Converters;
+}
+
+#else
+
+const VectorizedConverter *getSSSE3Converters(size_t &length)
+{
+  length = 0;
+  return nullptr;
+}
+
+#endif
@@ -96,8 +96,10 @@ local SoapySDR =
     -- @field CF64 LuaJIT type "complex"
     -- @field CF32 LuaJIT type "complex float"
     -- @field CS32 complex int32_t (no native LuaJIT type)
+    -- @field CS32BE complex big endian int32_t (usually over-the-wire)
     -- @field CU32 complex uint32_t (no native LuaJIT type)
     -- @field CS16 complex int16_t (no native LuaJIT type)
+    -- @field CS16BE complex big endian int16_t (usually over-the-wire)
     -- @field CU16 complex uint16_t (no native LuaJIT type)
     -- @field CS12 complex int12_t (usually over-the-wire)
     -- @field CU12 complex uint12_t (usually over-the-wire)
@@ -107,6 +109,9 @@ local SoapySDR =
     -- @field CU4 complex uint4_t (usually over-the-wire)
     -- @field F64 double
     -- @field F32 float
+    -- @field F32POW float power of complex samples
+    -- @field F32MAG float magnitude of complex samples
+    -- @field F32DB float power of complex samples in dB
     -- @field S32 int32_t
     -- @field U32 uint32_t
     -- @field S16 int16_t
@@ -120,8 +125,10 @@ local SoapySDR =
         CF64 = "CF64",
         CF32 = "CF32",
         CS32 = "CS32",
+        CS32BE = "CS32BE",
         CU32 = "CU32",
         CS16 = "CS16",
+        CS16BE = "CS16BE",
         CU16 = "CU16",
         CS12 = "CS12",
         CU12 = "CU12",
@@ -132,6 +139,9 @@ local SoapySDR =
 
         F64 = "F64",
         F32 = "F32",
+        F32POW = "F32POW",
+        F32MAG = "F32MAG",
+        F32DB = "F32DB",
         S32 = "S32",
         U32 = "U32",
         S16 = "S16",
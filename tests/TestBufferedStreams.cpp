@@ -0,0 +1,405 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/BufferedStreams.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Errors.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+static const size_t NUM_CHANS = 2;
+static const size_t MTU = 100;
+
+//a receive stream of a counter that starts at the channel index times a million,
+//with one nanosecond per element, followed by timeouts or an error
+class CounterDevice : public SoapySDR::Device
+{
+public:
+    CounterDevice(const size_t total, const size_t directSize, const int endError):
+        total(total),
+        directSize(directSize),
+        endError(endError),
+        count(0),
+        buff(NUM_CHANS, std::vector<int32_t>(directSize))
+    {
+        return;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return MTU;
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        return this->fill(buffs, numElems, flags, timeNs, timeoutUs);
+    }
+
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *)
+    {
+        return (directSize == 0)?0:1;
+    }
+
+    int acquireReadBuffer(SoapySDR::Stream *, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        handle = 0;
+        void *ptrs[NUM_CHANS];
+        for (size_t i = 0; i < NUM_CHANS; i++) buffs[i] = ptrs[i] = buff[i].data();
+        return this->fill(ptrs, directSize, flags, timeNs, timeoutUs);
+    }
+
+    size_t total;
+    size_t directSize;
+    int endError;
+    std::atomic<size_t> count;
+    std::vector<std::vector<int32_t>> buff;
+
+private:
+    int fill(void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        if (count == total)
+        {
+            if (endError != 0) return endError;
+            std::this_thread::sleep_for(std::chrono::microseconds(timeoutUs));
+            return SOAPY_SDR_TIMEOUT;
+        }
+        const size_t n = std::min(numElems, total-count);
+        for (size_t i = 0; i < NUM_CHANS; i++)
+        {
+            for (size_t j = 0; j < n; j++) ((int32_t *)buffs[i])[j] = int32_t(i*1000000 + count + j);
+        }
+        flags = SOAPY_SDR_HAS_TIME;
+        timeNs = (long long)count;
+        count += n;
+        return int(n);
+    }
+};
+
+//a transmit stream that accepts at most 64 elements per call and records every call
+class SinkDevice : public SoapySDR::Device
+{
+public:
+    SinkDevice(const int writeError):
+        writeError(writeError),
+        writeLimit(size_t(-1)),
+        statusEvent(0)
+    {
+        return;
+    }
+
+    int readStreamStatus(SoapySDR::Stream *, size_t &chanMask, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        const int ret = statusEvent.exchange(0);
+        if (ret == 0)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(timeoutUs));
+            return SOAPY_SDR_TIMEOUT;
+        }
+        chanMask = 0x1;
+        flags = 0;
+        timeNs = 0;
+        return ret;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return MTU;
+    }
+
+    int writeStream(SoapySDR::Stream *, const void * const *buffs, const size_t numElems, int &flags, const long long timeNs, const long)
+    {
+        if (writeError != 0) return writeError;
+        std::unique_lock<std::mutex> lock(mutex);
+        if (samples.size() >= writeLimit)
+        {
+            lock.unlock();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            return SOAPY_SDR_TIMEOUT;
+        }
+        const size_t n = std::min<size_t>(numElems, 64);
+        for (size_t j = 0; j < n; j++) samples.push_back(((const int32_t *)buffs[1])[j]);
+        calls.push_back(Call{n, flags, timeNs});
+        return int(n);
+    }
+
+    struct Call
+    {
+        size_t numElems;
+        int flags;
+        long long timeNs;
+    };
+
+    int writeError;
+    std::atomic<size_t> writeLimit;
+    std::atomic<int> statusEvent;
+    std::mutex mutex;
+    std::vector<int32_t> samples;
+    std::vector<Call> calls;
+};
+
+//read everything in the stream with the given read size and check the counter and time
+static bool checkRead(SoapySDR::BufferedRxStream &rx, const size_t readSize, const size_t total, const int endError)
+{
+    std::vector<std::vector<int32_t>> out(NUM_CHANS, std::vector<int32_t>(readSize));
+    void *buffs[NUM_CHANS] = {out[0].data(), out[1].data()};
+    size_t count(0);
+    while (count < total)
+    {
+        int flags(0);
+        long long timeNs(0);
+        const int ret = rx.read(buffs, readSize, flags, timeNs, 1000000);
+        if (ret <= 0)
+        {
+            printf("FAIL: read %d at %d\n", ret, int(count));
+            return false;
+        }
+        if ((flags & SOAPY_SDR_HAS_TIME) != 0 and timeNs != (long long)count)
+        {
+            printf("FAIL: time %lld at %d\n", timeNs, int(count));
+            return false;
+        }
+        if ((count % MTU == 0) != ((flags & SOAPY_SDR_HAS_TIME) != 0))
+        {
+            printf("FAIL: flags 0x%x at %d\n", flags, int(count));
+            return false;
+        }
+        for (size_t i = 0; i < NUM_CHANS; i++)
+        {
+            for (size_t j = 0; j < size_t(ret); j++)
+            {
+                if (out[i][j] == int32_t(i*1000000 + count + j)) continue;
+                printf("FAIL: sample %d at %d\n", int(out[i][j]), int(count + j));
+                return false;
+            }
+        }
+        count += size_t(ret);
+    }
+
+    int flags(0);
+    long long timeNs(0);
+    const int ret = rx.read(buffs, readSize, flags, timeNs, 1000);
+    const int expected = (endError == 0)?SOAPY_SDR_TIMEOUT:endError;
+    if (ret != expected)
+    {
+        printf("FAIL: end of stream %s\n", SoapySDR::errToStr(ret));
+        return false;
+    }
+    return true;
+}
+
+int main(void)
+{
+    printf("Check buffered readStream ... ");
+    for (const size_t readSize : {size_t(MTU), size_t(30), size_t(1000)})
+    {
+        CounterDevice device(10000, 0, 0);
+        SoapySDR::BufferedRxStream rx(&device, nullptr, SOAPY_SDR_S32, NUM_CHANS);
+        if (rx.getMTU() != MTU or rx.activate() != 0) return EXIT_FAILURE;
+        if (not checkRead(rx, readSize, 10000, 0) or rx.getNumOverflows() != 0) return EXIT_FAILURE;
+    }
+    printf("OK\n");
+
+    printf("Check buffered acquireReadBuffer ... ");
+    {
+        //direct buffers larger than the MTU are split into several chunks
+        CounterDevice device(2*MTU+50, 2*MTU+50, 0);
+        SoapySDR::BufferedRxStream rx(&device, nullptr, SOAPY_SDR_S32, NUM_CHANS);
+        rx.activate();
+        std::vector<int32_t> out0(MTU), out1(MTU);
+        void *buffs[NUM_CHANS] = {out0.data(), out1.data()};
+        const int sizes[] = {int(MTU), int(MTU), 50};
+        for (size_t i = 0; i < 3; i++)
+        {
+            int flags(0);
+            long long timeNs(0);
+            const int ret = rx.read(buffs, MTU, flags, timeNs, 1000000);
+            if (ret != sizes[i] or out1[0] != int32_t(1000000 + i*MTU) or ((flags & SOAPY_SDR_HAS_TIME) != 0) != (i == 0))
+            {
+                printf("FAIL: read %d with flags 0x%x\n", ret, flags);
+                return EXIT_FAILURE;
+            }
+        }
+        rx.deactivate();
+    }
+    printf("OK\n");
+
+    printf("Check stream errors ... ");
+    {
+        CounterDevice device(1000, 0, SOAPY_SDR_STREAM_ERROR);
+        SoapySDR::BufferedRxStream rx(&device, nullptr, SOAPY_SDR_S32, NUM_CHANS);
+        rx.activate();
+        if (not checkRead(rx, MTU, 1000, SOAPY_SDR_STREAM_ERROR)) return EXIT_FAILURE;
+    }
+    printf("OK\n");
+
+    printf("Check ring overflow ... ");
+    {
+        //the consumer stalls until the device is drained, overflowing a ring of 4 chunks
+        CounterDevice device(10000, 0, 0);
+        SoapySDR::BufferedRxStream rx(&device, nullptr, SOAPY_SDR_S32, NUM_CHANS, 4);
+        rx.activate();
+        while (device.count != device.total) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+        std::vector<int32_t> out0(MTU), out1(MTU);
+        void *buffs[NUM_CHANS] = {out0.data(), out1.data()};
+        std::vector<int> rets;
+        for (size_t i = 0; i < 6; i++)
+        {
+            int flags(0);
+            long long timeNs(0);
+            rets.push_back(rx.read(buffs, MTU, flags, timeNs, 200000));
+        }
+        const std::vector<int> expected = {int(MTU), int(MTU), int(MTU), int(MTU), SOAPY_SDR_OVERFLOW, SOAPY_SDR_TIMEOUT};
+        if (rets != expected or rx.getNumOverflows() != 1)
+        {
+            printf("FAIL: %d overflows\n", int(rx.getNumOverflows()));
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("Check buffered timed burst ... ");
+    {
+        //the burst prefills the ring before activation and is split over chunks and writes
+        SinkDevice device(0);
+        SoapySDR::BufferedTxStream tx(&device, nullptr, SOAPY_SDR_S32, NUM_CHANS);
+        std::vector<int32_t> in0(250), in1(250);
+        for (size_t j = 0; j < in1.size(); j++) in1[j] = int32_t(j);
+        const void *buffs[NUM_CHANS] = {in0.data(), in1.data()};
+        if (tx.write(buffs, 250, SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST, 5000) != 250) return EXIT_FAILURE;
+        if (tx.activate() != 0 or tx.flush(1000000) != 0) return EXIT_FAILURE;
+
+        std::lock_guard<std::mutex> lock(device.mutex);
+        bool ok = (device.samples == in1) and (device.calls.size() == 5);
+        for (size_t i = 0; ok and i < device.calls.size(); i++)
+        {
+            const auto &call = device.calls[i];
+            const bool first(i == 0), last(i+1 == device.calls.size());
+            ok = (((call.flags & SOAPY_SDR_HAS_TIME) != 0) == first) and (((call.flags & SOAPY_SDR_END_BURST) != 0) == last);
+            if (first) ok = ok and call.timeNs == 5000;
+        }
+        if (not ok)
+        {
+            printf("FAIL: %d samples in %d writes\n", int(device.samples.size()), int(device.calls.size()));
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("Check buffered partial chunk across deactivate ... ");
+    {
+        //the device stalls in the middle of the first chunk while the stream is deactivated
+        SinkDevice device(0);
+        device.writeLimit = 64;
+        SoapySDR::BufferedTxStream tx(&device, nullptr, SOAPY_SDR_S32, NUM_CHANS);
+        std::vector<int32_t> in0(250), in1(250);
+        for (size_t j = 0; j < in1.size(); j++) in1[j] = int32_t(j);
+        const void *buffs[NUM_CHANS] = {in0.data(), in1.data()};
+        if (tx.write(buffs, 250, SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST, 5000) != 250) return EXIT_FAILURE;
+        if (tx.activate() != 0) return EXIT_FAILURE;
+        while (true)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            std::lock_guard<std::mutex> lock(device.mutex);
+            if (device.samples.size() == 64) break;
+        }
+        tx.deactivate();
+
+        //the rest of the chunk is sent after activation, without the time of its first element
+        device.writeLimit = size_t(-1);
+        if (tx.activate() != 0 or tx.flush(1000000) != 0) return EXIT_FAILURE;
+        std::lock_guard<std::mutex> lock(device.mutex);
+        bool ok = (device.samples == in1) and (device.calls.size() == 5);
+        for (size_t i = 0; ok and i < device.calls.size(); i++)
+        {
+            const auto &call = device.calls[i];
+            const bool first(i == 0), last(i+1 == device.calls.size());
+            ok = (((call.flags & SOAPY_SDR_HAS_TIME) != 0) == first) and (((call.flags & SOAPY_SDR_END_BURST) != 0) == last);
+        }
+        if (not ok)
+        {
+            printf("FAIL: %d samples in %d writes\n", int(device.samples.size()), int(device.calls.size()));
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("Check buffered underflow ... ");
+    {
+        SinkDevice device(0);
+        SoapySDR::BufferedTxStream tx(&device, nullptr, SOAPY_SDR_S32, NUM_CHANS);
+        std::vector<int32_t> in0(MTU), in1(MTU);
+        const void *buffs[NUM_CHANS] = {in0.data(), in1.data()};
+        size_t chanMask(0);
+        int flags(0);
+        long long timeNs(0);
+        tx.activate();
+
+        //the ring runs dry in the middle of a burst, which is not an underflow
+        tx.write(buffs, MTU);
+        if (tx.flush(1000000) != 0 or tx.readStatus(chanMask, flags, timeNs, 10000) != SOAPY_SDR_TIMEOUT or
+            tx.getNumUnderflows() != 0 or tx.getNumStarvations() != 1)
+        {
+            printf("FAIL: starved ring\n");
+            return EXIT_FAILURE;
+        }
+
+        //an empty ring after the end of a burst is not a starvation
+        tx.write(buffs, MTU, SOAPY_SDR_END_BURST);
+        if (tx.flush(1000000) != 0 or tx.getNumStarvations() != 1)
+        {
+            printf("FAIL: unexpected starvation\n");
+            return EXIT_FAILURE;
+        }
+
+        //the underflow of the driver is reported and counted once
+        device.statusEvent = SOAPY_SDR_UNDERFLOW;
+        if (tx.readStatus(chanMask, flags, timeNs, 1000000) != SOAPY_SDR_UNDERFLOW or chanMask != 0x1 or tx.getNumUnderflows() != 1 or
+            tx.readStatus(chanMask, flags, timeNs, 10000) != SOAPY_SDR_TIMEOUT)
+        {
+            printf("FAIL: no underflow\n");
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("Check buffered write errors ... ");
+    {
+        SinkDevice device(SOAPY_SDR_TIME_ERROR);
+        SoapySDR::BufferedTxStream tx(&device, nullptr, SOAPY_SDR_S32, NUM_CHANS, 2);
+        std::vector<int32_t> in0(MTU), in1(MTU);
+        const void *buffs[NUM_CHANS] = {in0.data(), in1.data()};
+        size_t chanMask(0);
+        int flags(0);
+        long long timeNs(0);
+
+        //a full ring times out before activation
+        if (tx.write(buffs, MTU, SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST, 1000) != int(MTU) or
+            tx.write(buffs, MTU, SOAPY_SDR_END_BURST) != int(MTU) or
+            tx.write(buffs, MTU, 0, 0, 1000) != SOAPY_SDR_TIMEOUT or
+            tx.flush(1000) != SOAPY_SDR_TIMEOUT)
+        {
+            printf("FAIL: full ring\n");
+            return EXIT_FAILURE;
+        }
+
+        //the late burst is reported with its time
+        tx.activate();
+        if (tx.readStatus(chanMask, flags, timeNs, 1000000) != SOAPY_SDR_TIME_ERROR or timeNs != 1000 or tx.flush(1000000) != 0)
+        {
+            printf("FAIL: no time error\n");
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
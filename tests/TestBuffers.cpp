@@ -0,0 +1,129 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Buffers.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <utility>
+
+//a device that only reports a stream MTU
+class MTUDevice : public SoapySDR::Device
+{
+public:
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return 1000;
+    }
+};
+
+//every buffer is aligned, sized, writable, and disjoint from the others
+static bool checkPool(const SoapySDR::BufferPool &pool, const size_t numBuffs, const size_t numBytes, const int flags)
+{
+    if (pool.getNumBuffers() != numBuffs or pool.getNumBytes() != numBytes)
+    {
+        printf("FAIL: %d buffers of %d bytes\n", int(pool.getNumBuffers()), int(pool.getNumBytes()));
+        return false;
+    }
+    if ((pool.getFlags() & ~flags) != 0)
+    {
+        printf("FAIL: unrequested flags 0x%x\n", pool.getFlags());
+        return false;
+    }
+    for (size_t i = 0; i < numBuffs; i++)
+    {
+        if (size_t(pool.getBuffer(i)) % SOAPY_SDR_BUFFER_ALIGNMENT != 0 or pool.getBuffers()[i] != pool.getBuffer(i))
+        {
+            printf("FAIL: buffer %d is not aligned\n", int(i));
+            return false;
+        }
+        std::memset(pool.getBuffer(i), int(i+1), numBytes);
+    }
+    for (size_t i = 0; i < numBuffs; i++)
+    {
+        const auto *p = (const unsigned char *)pool.getBuffer(i);
+        for (size_t j = 0; j < numBytes; j++)
+        {
+            if (p[j] != (unsigned char)(i+1))
+            {
+                printf("FAIL: buffer %d overlaps another buffer\n", int(i));
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(void)
+{
+    printf("Check default allocation ... ");
+    {
+        SoapySDR::BufferPool pool(3, 1000);
+        if (not checkPool(pool, 3, 1000, 0)) return EXIT_FAILURE;
+        printf("OK\n");
+    }
+
+    printf("Check optional flags ... ");
+    {
+        //the flags are best-effort, so only check what the pool reports
+        const int flags = SOAPY_SDR_BUFFER_HUGE_PAGES | SOAPY_SDR_BUFFER_LOCKED | SOAPY_SDR_BUFFER_NUMA_LOCAL;
+        SoapySDR::BufferPool pool(4, 4096+1, flags);
+        if (not checkPool(pool, 4, 4096+1, flags)) return EXIT_FAILURE;
+        printf("OK (flags=0x%x)\n", pool.getFlags());
+    }
+
+    printf("Check move ... ");
+    {
+        SoapySDR::BufferPool pool(2, 64);
+        void *buff = pool.getBuffer(0);
+        SoapySDR::BufferPool moved(std::move(pool));
+        SoapySDR::BufferPool assigned;
+        assigned = std::move(moved);
+        if (pool.getNumBuffers() != 0 or moved.getNumBuffers() != 0 or assigned.getBuffer(0) != buff or not checkPool(assigned, 2, 64, 0))
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+    }
+
+    printf("Check stream MTU sizing ... ");
+    {
+        MTUDevice device;
+        const auto pool = SoapySDR::allocateBuffers(&device, nullptr, SOAPY_SDR_CS16, 2);
+        if (not checkPool(pool, 2, 1000*SoapySDR::formatToSize(SOAPY_SDR_CS16), 0)) return EXIT_FAILURE;
+        printf("OK\n");
+    }
+
+    printf("Check invalid sizes ... ");
+    try
+    {
+        SoapySDR::BufferPool pool(1, 0);
+        printf("FAIL\n");
+        return EXIT_FAILURE;
+    }
+    catch (const std::invalid_argument &)
+    {
+        printf("OK\n");
+    }
+
+    printf("Check C API ... ");
+    {
+        SoapySDRBufferPool *pool = SoapySDRBufferPool_make(2, 100, 0);
+        size_t length(0);
+        void **buffs = (pool == nullptr)?nullptr:SoapySDRBufferPool_getBuffers(pool, &length);
+        if (buffs == nullptr or length != 2 or size_t(buffs[1]) % SOAPY_SDR_BUFFER_ALIGNMENT != 0 or
+            SoapySDRBufferPool_getNumBytes(pool) != 100 or SoapySDRBufferPool_getFlags(pool) != 0 or
+            SoapySDRBufferPool_unmake(pool) != 0 or SoapySDRBufferPool_make(1, 0, 0) != nullptr)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+    }
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,765 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConverterPrimitives.hpp>
+#include <SoapySDR/ConverterRegistry.hpp>
+#include <SoapySDR/Converters.h>
+#include <SoapySDR/Formats.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+//odd length exercises both the SIMD body and the scalar tail
+static const size_t NUM_ELEMS = 1021;
+
+//a converter for a custom format without a known size, which must never be timed
+static bool unsizedCalled = false;
+static void unsizedConverter(const void *, void *, const size_t, const double)
+{
+    unsizedCalled = true;
+}
+
+//fill a buffer of the given format with deterministic in-range values
+static void fillBuffer(const std::string &format, std::vector<char> &buff)
+{
+    std::srand(42);
+    if (format == SOAPY_SDR_CF32 or format == SOAPY_SDR_F32)
+    {
+        auto *p = (float *)buff.data();
+        for (size_t i = 0; i < buff.size()/sizeof(float); i++) p[i] = float(std::rand())/RAND_MAX*1.98f - 0.99f;
+    }
+    else if (format == SOAPY_SDR_CF64 or format == SOAPY_SDR_F64)
+    {
+        auto *p = (double *)buff.data();
+        for (size_t i = 0; i < buff.size()/sizeof(double); i++) p[i] = double(std::rand())/RAND_MAX*1.98 - 0.99;
+    }
+    else for (size_t i = 0; i < buff.size(); i++) buff[i] = char(std::rand());
+}
+
+//read back an output buffer of the given format as scalar values
+static std::vector<double> toValues(const std::string &format, const std::vector<char> &buff)
+{
+    std::vector<double> out;
+    for (size_t i = 0; i < NUM_ELEMS; i++)
+    {
+        if (format == SOAPY_SDR_CF32) for (size_t j = 0; j < 2; j++) out.push_back(((const float *)buff.data())[i*2+j]);
+        if (format == SOAPY_SDR_CF64) for (size_t j = 0; j < 2; j++) out.push_back(((const double *)buff.data())[i*2+j]);
+        if (format == SOAPY_SDR_F32 or format == SOAPY_SDR_F32POW or format == SOAPY_SDR_F32MAG or format == SOAPY_SDR_F32DB) out.push_back(((const float *)buff.data())[i]);
+        if (format == SOAPY_SDR_F64) out.push_back(((const double *)buff.data())[i]);
+        if (format == SOAPY_SDR_CS16) for (size_t j = 0; j < 2; j++) out.push_back(((const int16_t *)buff.data())[i*2+j]);
+        if (format == SOAPY_SDR_CS16BE) for (size_t j = 0; j < 2; j++) out.push_back(SoapySDR::S16BEtoS16(((const int16_t *)buff.data())[i*2+j]));
+        if (format == SOAPY_SDR_CS32BE) for (size_t j = 0; j < 2; j++) out.push_back(SoapySDR::S32BEtoS32(((const int32_t *)buff.data())[i*2+j]));
+        if (format == SOAPY_SDR_CS8) for (size_t j = 0; j < 2; j++) out.push_back(((const int8_t *)buff.data())[i*2+j]);
+        if (format == SOAPY_SDR_CU16) for (size_t j = 0; j < 2; j++) out.push_back(((const uint16_t *)buff.data())[i*2+j]);
+        if (format == SOAPY_SDR_CU8) for (size_t j = 0; j < 2; j++) out.push_back(((const uint8_t *)buff.data())[i*2+j]);
+        if (format == SOAPY_SDR_CS12 or format == SOAPY_SDR_CU12)
+        {
+            int16_t i16, q16;
+            SoapySDR::CS12toCS16((const uint8_t *)buff.data()+i*3, i16, q16);
+            out.push_back(i16 >> 4);
+            out.push_back(q16 >> 4);
+        }
+        if (format == SOAPY_SDR_CS4 or format == SOAPY_SDR_CU4)
+        {
+            int8_t i8, q8;
+            SoapySDR::CS4toCS8(((const uint8_t *)buff.data())[i], i8, q8);
+            out.push_back(i8 >> 4);
+            out.push_back(q8 >> 4);
+        }
+    }
+    return out;
+}
+
+//compare two output buffers of the given format allowing for rounding differences
+static bool compareBuffers(const std::string &format, const std::vector<char> &a, const std::vector<char> &b)
+{
+    const bool isFloat = (SoapySDR::formatToSize(format) != 0 and format.find('F') != std::string::npos);
+    const auto x = toValues(format, a);
+    const auto y = toValues(format, b);
+    for (size_t i = 0; i < x.size(); i++)
+    {
+        //floats are compared relative to the magnitude once above full scale (dB values)
+        const double tol = isFloat?1e-6*std::max(1.0, std::abs(x[i])):1;
+        if (std::abs(x[i]-y[i]) > tol)
+        {
+            printf("FAIL: index %d: %f != %f\n", int(i), x[i], y[i]);
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool checkVectorized(const std::string &source, const std::string &target, const double scaler)
+{
+    printf("Check %s -> %s (scaler=%g) ... ", source.c_str(), target.c_str(), scaler);
+    const auto priorities = SoapySDR::ConverterRegistry::listPriorities(source, target);
+    if (std::find(priorities.begin(), priorities.end(), SoapySDR::ConverterRegistry::VECTORIZED) == priorities.end())
+    {
+        printf("SKIP: no vectorized converter\n");
+        return true;
+    }
+
+    std::vector<char> in(NUM_ELEMS*SoapySDR::formatToSize(source));
+    std::vector<char> outGeneric(NUM_ELEMS*SoapySDR::formatToSize(target));
+    std::vector<char> outVectorized(outGeneric.size());
+    fillBuffer(source, in);
+
+    auto generic = SoapySDR::ConverterRegistry::getFunction(source, target, SoapySDR::ConverterRegistry::GENERIC);
+    auto vectorized = SoapySDR::ConverterRegistry::getFunction(source, target, SoapySDR::ConverterRegistry::VECTORIZED);
+    generic(in.data(), outGeneric.data(), NUM_ELEMS, scaler);
+    vectorized(in.data(), outVectorized.data(), NUM_ELEMS, scaler);
+
+    if (SoapySDR::ConverterRegistry::getFunction(source, target) != vectorized)
+    {
+        printf("FAIL: highest priority is not the vectorized converter\n");
+        return false;
+    }
+    if (not compareBuffers(target, outGeneric, outVectorized)) return false;
+    printf("OK (%s)\n", SoapySDR::ConverterRegistry::getInstructionSet(source, target, SoapySDR::ConverterRegistry::VECTORIZED).c_str());
+    return true;
+}
+
+static bool checkLayout(const std::string &source, const std::string &target, const size_t numChans, const double scaler)
+{
+    printf("Check %s -> %s x%d channels (scaler=%g) ... ", source.c_str(), target.c_str(), int(numChans), scaler);
+    SoapySDR::ConverterRegistry::DeinterleaveFunction deinterleave[2] = {};
+    SoapySDR::ConverterRegistry::InterleaveFunction interleave[2] = {};
+    try
+    {
+        deinterleave[0] = SoapySDR::ConverterRegistry::getDeinterleaveFunction(source, target, SoapySDR::ConverterRegistry::GENERIC);
+        deinterleave[1] = SoapySDR::ConverterRegistry::getDeinterleaveFunction(source, target, SoapySDR::ConverterRegistry::VECTORIZED);
+    }
+    catch (const std::runtime_error &) {}
+    try
+    {
+        interleave[0] = SoapySDR::ConverterRegistry::getInterleaveFunction(source, target, SoapySDR::ConverterRegistry::GENERIC);
+        interleave[1] = SoapySDR::ConverterRegistry::getInterleaveFunction(source, target, SoapySDR::ConverterRegistry::VECTORIZED);
+    }
+    catch (const std::runtime_error &) {}
+    if (deinterleave[1] == nullptr and interleave[1] == nullptr)
+    {
+        printf("SKIP: no vectorized converter\n");
+        return true;
+    }
+
+    const size_t srcSize = SoapySDR::formatToSize(source), dstSize = SoapySDR::formatToSize(target);
+    if (deinterleave[1] != nullptr)
+    {
+        std::vector<char> in(NUM_ELEMS*numChans*srcSize);
+        fillBuffer(source, in);
+        std::vector<std::vector<char>> out[2];
+        std::vector<void *> outPtrs[2];
+        for (size_t k = 0; k < 2; k++)
+        {
+            out[k].resize(numChans, std::vector<char>(NUM_ELEMS*dstSize));
+            for (auto &buff : out[k]) outPtrs[k].push_back(buff.data());
+            deinterleave[k](in.data(), outPtrs[k].data(), numChans, NUM_ELEMS, scaler);
+        }
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            if (not compareBuffers(target, out[0][ch], out[1][ch])) return false;
+        }
+    }
+    if (interleave[1] != nullptr)
+    {
+        std::vector<std::vector<char>> in(numChans, std::vector<char>(NUM_ELEMS*srcSize));
+        std::vector<const void *> inPtrs;
+        for (auto &buff : in)
+        {
+            fillBuffer(source, buff);
+            inPtrs.push_back(buff.data());
+        }
+        std::vector<char> out[2];
+        for (size_t k = 0; k < 2; k++)
+        {
+            out[k].resize(NUM_ELEMS*numChans*dstSize);
+            interleave[k](inPtrs.data(), out[k].data(), numChans, NUM_ELEMS, scaler);
+        }
+        //compare in NUM_ELEMS sized pieces of the interleaved output
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            const auto begin = ch*NUM_ELEMS*dstSize, end = (ch+1)*NUM_ELEMS*dstSize;
+            const std::vector<char> a(out[0].begin()+begin, out[0].begin()+end);
+            const std::vector<char> b(out[1].begin()+begin, out[1].begin()+end);
+            if (not compareBuffers(target, a, b)) return false;
+        }
+    }
+    printf("OK\n");
+    return true;
+}
+
+int main(void)
+{
+    bool ok = true;
+
+    printf("Check vectorized converters:\n");
+    ok = ok and checkVectorized(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 1.0);
+    ok = ok and checkVectorized(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 0.5);
+    ok = ok and checkVectorized(SOAPY_SDR_CF32, SOAPY_SDR_CS16, 1.0);
+    ok = ok and checkVectorized(SOAPY_SDR_CF32, SOAPY_SDR_CS16, 0.5);
+    ok = ok and checkVectorized(SOAPY_SDR_CS8, SOAPY_SDR_CF32, 1.0);
+    ok = ok and checkVectorized(SOAPY_SDR_CS8, SOAPY_SDR_CF32, 0.5);
+    ok = ok and checkVectorized(SOAPY_SDR_CF32, SOAPY_SDR_CS8, 1.0);
+    ok = ok and checkVectorized(SOAPY_SDR_CF32, SOAPY_SDR_CS8, 0.5);
+    ok = ok and checkVectorized(SOAPY_SDR_CF32, SOAPY_SDR_CU8, 1.0);
+    ok = ok and checkVectorized(SOAPY_SDR_CF32, SOAPY_SDR_CU8, 0.5);
+    for (const auto &packed : {SOAPY_SDR_CS12, SOAPY_SDR_CU12})
+    {
+        for (const auto &other : {SOAPY_SDR_CS16, SOAPY_SDR_CF32})
+        {
+            ok = ok and checkVectorized(packed, other, 1.0);
+            ok = ok and checkVectorized(packed, other, 0.5);
+            ok = ok and checkVectorized(other, packed, 1.0);
+            ok = ok and checkVectorized(other, packed, 0.5);
+        }
+
+        //scalers above one saturate, 3.0 takes the floating point path
+        for (const auto &scaler : {4.0, 3.0, 0.3})
+        {
+            ok = ok and checkVectorized(packed, SOAPY_SDR_CS16, scaler);
+            ok = ok and checkVectorized(SOAPY_SDR_CS16, packed, scaler);
+        }
+    }
+    for (const auto &packed : {SOAPY_SDR_CS4, SOAPY_SDR_CU4})
+    {
+        for (const auto &other : {SOAPY_SDR_CS8, SOAPY_SDR_CS16, SOAPY_SDR_CF32})
+        {
+            ok = ok and checkVectorized(packed, other, 1.0);
+            ok = ok and checkVectorized(packed, other, 0.5);
+            ok = ok and checkVectorized(packed, other, 4.0);
+            ok = ok and checkVectorized(packed, other, 3.0);
+        }
+        ok = ok and checkVectorized(SOAPY_SDR_CF32, packed, 1.0);
+        ok = ok and checkVectorized(SOAPY_SDR_CF32, packed, 0.5);
+    }
+    for (const auto &scaler : {1.0, 0.5})
+    {
+        ok = ok and checkVectorized(SOAPY_SDR_F32, SOAPY_SDR_F64, scaler);
+        ok = ok and checkVectorized(SOAPY_SDR_F64, SOAPY_SDR_F32, scaler);
+        ok = ok and checkVectorized(SOAPY_SDR_CF32, SOAPY_SDR_CF64, scaler);
+        ok = ok and checkVectorized(SOAPY_SDR_CF64, SOAPY_SDR_CF32, scaler);
+        ok = ok and checkVectorized(SOAPY_SDR_CS16, SOAPY_SDR_CF64, scaler);
+        ok = ok and checkVectorized(SOAPY_SDR_CS8, SOAPY_SDR_CF64, scaler);
+    }
+    for (const auto &scaler : {1.0, 0.5})
+    {
+        ok = ok and checkVectorized(SOAPY_SDR_CS16BE, SOAPY_SDR_CF32, scaler);
+        ok = ok and checkVectorized(SOAPY_SDR_CF32, SOAPY_SDR_CS16BE, scaler);
+        ok = ok and checkVectorized(SOAPY_SDR_CS32BE, SOAPY_SDR_CF32, scaler);
+        ok = ok and checkVectorized(SOAPY_SDR_CF32, SOAPY_SDR_CS32BE, scaler);
+    }
+    for (const auto &source : {SOAPY_SDR_CF32, SOAPY_SDR_CS16, SOAPY_SDR_CS8})
+    {
+        for (const auto &target : {SOAPY_SDR_F32POW, SOAPY_SDR_F32MAG, SOAPY_SDR_F32DB})
+        {
+            ok = ok and checkVectorized(source, target, 1.0);
+            ok = ok and checkVectorized(source, target, 0.5);
+        }
+    }
+    const std::pair<std::string, std::string> integerPairs[] = {
+        {SOAPY_SDR_CS16, SOAPY_SDR_CS8}, {SOAPY_SDR_CS16, SOAPY_SDR_CU16}, {SOAPY_SDR_CS8, SOAPY_SDR_CU8},
+        {SOAPY_SDR_CS16BE, SOAPY_SDR_CS16}};
+    for (const auto &pair : integerPairs)
+    {
+        //powers of two take the shift paths, 0.3 takes the floating point path
+        for (const auto &scaler : {1.0, 4.0, 0.25, 0.3})
+        {
+            ok = ok and checkVectorized(pair.first, pair.second, scaler);
+            ok = ok and checkVectorized(pair.second, pair.first, scaler);
+        }
+    }
+    for (size_t numChans = 1; numChans <= 5; numChans++)
+    {
+        ok = ok and checkLayout(SOAPY_SDR_CS16, SOAPY_SDR_CS16, numChans, 1.0);
+        ok = ok and checkLayout(SOAPY_SDR_CS16, SOAPY_SDR_CS16, numChans, 0.5);
+        ok = ok and checkLayout(SOAPY_SDR_CS16, SOAPY_SDR_CS16, numChans, 4.0);
+        ok = ok and checkLayout(SOAPY_SDR_CS16, SOAPY_SDR_CS16, numChans, 3.0);
+        ok = ok and checkLayout(SOAPY_SDR_CS16, SOAPY_SDR_CF32, numChans, 1.0);
+        ok = ok and checkLayout(SOAPY_SDR_CF32, SOAPY_SDR_CS16, numChans, 0.5);
+    }
+    if (not ok) return EXIT_FAILURE;
+
+    printf("Check packed 12-bit layout:\n");
+    {
+        const uint8_t cs12[3] = {0x21, 0x43, 0x65};
+        int16_t cs16[2] = {};
+        uint8_t back[3] = {};
+        SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS12, SOAPY_SDR_CS16)(cs12, cs16, 1, 1.0);
+        SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CS12)(cs16, back, 1, 1.0);
+        printf("  CS12 [21 43 65] -> CS16 [%04x %04x] -> CS12 [%02x %02x %02x] ... ",
+            uint16_t(cs16[0]), uint16_t(cs16[1]), back[0], back[1], back[2]);
+        if (cs16[0] != 0x3210 or cs16[1] != 0x6540 or std::memcmp(cs12, back, 3) != 0)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+    }
+
+    printf("Check packed 4-bit layout:\n");
+    {
+        const uint8_t cs4[1] = {0x7e};
+        int8_t cs8[2] = {};
+        float cf32[2] = {};
+        uint8_t back[1] = {};
+        SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS4, SOAPY_SDR_CS8)(cs4, cs8, 1, 1.0);
+        SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS4, SOAPY_SDR_CF32)(cs4, cf32, 1, 1.0);
+        SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CF32, SOAPY_SDR_CS4)(cf32, back, 1, 1.0);
+        printf("  CS4 [7e] -> CS8 [%d %d] -> CF32 [%g %g] -> CS4 [%02x] ... ", cs8[0], cs8[1], cf32[0], cf32[1], back[0]);
+        if (cs8[0] != -32 or cs8[1] != 112 or cf32[0] != -0.25f or cf32[1] != 0.875f or back[0] != cs4[0])
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+    }
+
+    printf("Check prepared converter:\n");
+    {
+        const SoapySDR::PreparedConverter conv(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 2.0);
+        const int16_t cs16[2] = {16384, -8192};
+        float cf32[2] = {};
+        conv.convert(cs16, cf32, 1);
+        printf("  %s -> %s (%s) [%g %g] ... ", conv.getSourceFormat().c_str(), conv.getTargetFormat().c_str(),
+            conv.getInstructionSet().c_str(), cf32[0], cf32[1]);
+        if (conv.getFunction() != SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32) or
+            conv.getSourceElemSize() != 4 or conv.getTargetElemSize() != 8 or cf32[0] != 1.0f or cf32[1] != -0.5f)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+
+        printf("  missing conversion throws ... ");
+        try
+        {
+            SoapySDR::PreparedConverter("BOGUS", SOAPY_SDR_CF32);
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        catch (const std::runtime_error &) {}
+        printf("OK\n");
+    }
+
+    printf("Check deinterleave layout:\n");
+    {
+        //element i of channel ch holds (i, ch) so misplaced samples are easy to spot
+        const size_t numChans = 4, numElems = 7;
+        std::vector<int16_t> in(numElems*numChans*2);
+        for (size_t i = 0; i < numElems; i++)
+            for (size_t ch = 0; ch < numChans; ch++)
+            {
+                in[(i*numChans+ch)*2+0] = int16_t(i*256);
+                in[(i*numChans+ch)*2+1] = int16_t(ch*256);
+            }
+        std::vector<std::vector<float>> out(numChans, std::vector<float>(numElems*2));
+        std::vector<void *> outPtrs;
+        for (auto &buff : out) outPtrs.push_back(buff.data());
+        SoapySDR::ConverterRegistry::getDeinterleaveFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32)(in.data(), outPtrs.data(), numChans, numElems, 128.0);
+        printf("  4x CS16 -> 4x CF32 ... ");
+        for (size_t i = 0; i < numElems; i++)
+            for (size_t ch = 0; ch < numChans; ch++)
+            {
+                if (out[ch][i*2+0] != float(i) or out[ch][i*2+1] != float(ch))
+                {
+                    printf("FAIL: channel %d element %d\n", int(ch), int(i));
+                    return EXIT_FAILURE;
+                }
+            }
+        printf("OK\n");
+    }
+
+    printf("Check multi-channel convert:\n");
+    {
+        const size_t numChans = 3;
+        const SoapySDR::PreparedConverter conv(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 0.5);
+        std::vector<std::vector<char>> in(numChans), outSingle(numChans), outBatch(numChans), outC(numChans);
+        std::vector<const void *> srcs;
+        std::vector<void *> dstsBatch, dstsC;
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            in[ch].resize(NUM_ELEMS*conv.getSourceElemSize());
+            outSingle[ch].resize(NUM_ELEMS*conv.getTargetElemSize());
+            outBatch[ch].resize(outSingle[ch].size());
+            outC[ch].resize(outSingle[ch].size());
+            fillBuffer(SOAPY_SDR_CS16, in[ch]);
+            conv.convert(in[ch].data(), outSingle[ch].data(), NUM_ELEMS);
+            srcs.push_back(in[ch].data());
+            dstsBatch.push_back(outBatch[ch].data());
+            dstsC.push_back(outC[ch].data());
+        }
+        conv.convert(srcs.data(), dstsBatch.data(), numChans, NUM_ELEMS);
+        const int ret = SoapySDRConverter_convertChannels(conv.getFunction(), srcs.data(), dstsC.data(), numChans, NUM_ELEMS, conv.getScaler());
+        printf("  %d channels ... ", int(numChans));
+        for (size_t ch = 0; ch < numChans; ch++)
+        {
+            if (ret != 0 or outBatch[ch] != outSingle[ch] or outC[ch] != outSingle[ch])
+            {
+                printf("FAIL: channel %d\n", int(ch));
+                return EXIT_FAILURE;
+            }
+        }
+        printf("OK\n");
+    }
+
+    printf("Check big endian byte order ... ");
+    {
+        //network order wire bytes, the most significant byte comes first
+        const uint8_t wire[] = {0x12, 0x34, 0xff, 0xfe};
+        int16_t out[2] = {};
+        SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16BE, SOAPY_SDR_CS16)(wire, out, 1, 1.0);
+        if (out[0] != 0x1234 or out[1] != -2)
+        {
+            printf("FAIL: got 0x%04x, 0x%04x\n", unsigned(uint16_t(out[0])), unsigned(uint16_t(out[1])));
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+    }
+
+    printf("Check saturation:\n");
+    {
+        //overdriven samples clip to the rails instead of wrapping around,
+        //including inputs that overflow the int32 range of the vector conversions,
+        //and NaN which maps to the negative rail like the vector conversions
+        const float inf = std::numeric_limits<float>::infinity();
+        const float nan = std::numeric_limits<float>::quiet_NaN();
+        const float pattern[] = {1.5f, -1.5f, 1.0f, -1.0f, 0.5f, -0.5f, 100.0f, -100.0f,
+            1e5f, -1e5f, 1e10f, -1e10f, inf, -inf, nan};
+        const size_t patternSize = sizeof(pattern)/sizeof(pattern[0]);
+        std::vector<char> in(NUM_ELEMS*SoapySDR::formatToSize(SOAPY_SDR_CF32));
+        auto *p = (float *)in.data();
+        for (size_t i = 0; i < NUM_ELEMS*2; i++) p[i] = pattern[i%patternSize];
+        const std::pair<std::string, double> targets[] = {
+            {SOAPY_SDR_CS16, 32768.0}, {SOAPY_SDR_CS8, 128.0}, {SOAPY_SDR_CU8, 128.0}, {SOAPY_SDR_CS32BE, 2147483648.0},
+            {SOAPY_SDR_CS12, 2048.0}, {SOAPY_SDR_CS4, 8.0}};
+        for (const auto &target : targets)
+        {
+            const double fullScale = target.second;
+            const double offset = (target.first == SOAPY_SDR_CU8)?128.0:0.0;
+            for (const auto &priority : SoapySDR::ConverterRegistry::listPriorities(SOAPY_SDR_CF32, target.first))
+            {
+                printf("  CF32 -> %s priority %d ... ", target.first.c_str(), priority);
+                std::vector<char> out(NUM_ELEMS*SoapySDR::formatToSize(target.first));
+                SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CF32, target.first, priority)(in.data(), out.data(), NUM_ELEMS, 1.0);
+                const auto values = toValues(target.first, out);
+                for (size_t i = 0; i < values.size(); i++)
+                {
+                    const double clipped = std::isnan(p[i])?-fullScale:std::min(std::max(p[i]*fullScale, -fullScale), fullScale-1);
+                    const double expected = std::trunc(clipped) + offset;
+                    if (values[i] != expected)
+                    {
+                        printf("FAIL: index %d: %f != %f\n", int(i), values[i], expected);
+                        return EXIT_FAILURE;
+                    }
+                }
+                printf("OK\n");
+            }
+        }
+    }
+
+    printf("Check power, magnitude, and dB ... ");
+    {
+        //half scale I with zero Q, then a zero element which stays finite in dB
+        const int16_t in[] = {16384, 0, 0, 0};
+        const std::pair<std::string, float> expected[] = {
+            {SOAPY_SDR_F32POW, 0.25f}, {SOAPY_SDR_F32MAG, 0.5f}, {SOAPY_SDR_F32DB, -6.0206f}};
+        for (const auto &pair : expected)
+        {
+            float out[2] = {};
+            SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, pair.first)(in, out, 2, 1.0);
+            if (std::abs(out[0]-pair.second) > 1e-3 or not std::isfinite(out[1]))
+            {
+                printf("FAIL: %s got %f, %f\n", pair.first.c_str(), out[0], out[1]);
+                return EXIT_FAILURE;
+            }
+        }
+        printf("OK\n");
+    }
+
+    printf("Check converter paths:\n");
+    {
+        //several blocks of the chain plus a partial block, scaled by the second conversion
+        const size_t numElems = 5000;
+        const double scaler = 0.5;
+        const std::string path[] = {SOAPY_SDR_CU8, SOAPY_SDR_CS8, SOAPY_SDR_CF64};
+        const SoapySDR::PreparedConverter conv(path[0], path[2], scaler);
+        std::vector<char> in(numElems*SoapySDR::formatToSize(path[0]));
+        std::vector<char> tmp(numElems*SoapySDR::formatToSize(path[1]));
+        std::vector<char> expected(numElems*SoapySDR::formatToSize(path[2]));
+        std::vector<char> out(expected.size());
+        fillBuffer(path[0], in);
+        SoapySDR::ConverterRegistry::getFunction(path[0], path[1])(in.data(), tmp.data(), numElems, 1.0);
+        SoapySDR::ConverterRegistry::getFunction(path[1], path[2])(tmp.data(), expected.data(), numElems, scaler);
+        conv.convert(in.data(), out.data(), numElems);
+        printf("  %s -> %s -> %s ... ", path[0].c_str(), path[1].c_str(), path[2].c_str());
+        if (conv.getPath() != std::vector<std::string>(path, path+3) or conv.getFunction() != nullptr or out != expected)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+
+        printf("  unreachable format is empty ... ");
+        if (not SoapySDR::ConverterRegistry::findPath(SOAPY_SDR_CS16, "BOGUS").empty())
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+    }
+
+    printf("Check in-place conversion:\n");
+    {
+        //functions registered as in-place match their output into a separate buffer
+        const size_t numElems = 20000;
+        for (const auto &source : SoapySDR::ConverterRegistry::listAvailableSourceFormats())
+        {
+            for (const auto &target : SoapySDR::ConverterRegistry::listTargetFormats(source))
+            {
+                for (const auto &priority : SoapySDR::ConverterRegistry::listPriorities(source, target))
+                {
+                    if (not SoapySDR::ConverterRegistry::isInPlace(source, target, priority)) continue;
+                    printf("  %s -> %s priority %d ... ", source.c_str(), target.c_str(), priority);
+                    const size_t sourceSize = SoapySDR::formatToSize(source);
+                    const size_t targetSize = SoapySDR::formatToSize(target);
+                    if (targetSize > sourceSize)
+                    {
+                        printf("FAIL: widening conversion registered as in-place\n");
+                        return EXIT_FAILURE;
+                    }
+                    auto fcn = SoapySDR::ConverterRegistry::getFunction(source, target, priority);
+                    for (const double scaler : {1.0, 0.5})
+                    {
+                        std::vector<char> buff(numElems*sourceSize);
+                        std::vector<char> expected(numElems*targetSize);
+                        fillBuffer(source, buff);
+                        fcn(buff.data(), expected.data(), numElems, scaler);
+                        fcn(buff.data(), buff.data(), numElems, scaler);
+                        if (std::memcmp(buff.data(), expected.data(), expected.size()) != 0)
+                        {
+                            printf("FAIL: scaler=%g\n", scaler);
+                            return EXIT_FAILURE;
+                        }
+                    }
+                    printf("OK\n");
+                }
+            }
+        }
+
+        printf("  registered attributes ... ");
+        if (not SoapySDR::ConverterRegistry::isInPlace(SOAPY_SDR_CS16, SOAPY_SDR_CU16, SoapySDR::ConverterRegistry::GENERIC) or
+            SoapySDR::ConverterRegistry::isInPlace(SOAPY_SDR_CS16, SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC) or
+            not SoapySDRConverter_isInPlace(SOAPY_SDR_CS16, SOAPY_SDR_CU16, SOAPY_SDR_CONVERTER_GENERIC) or
+            SoapySDRConverter_isInPlace(SOAPY_SDR_CS16, "BOGUS", SOAPY_SDR_CONVERTER_GENERIC) or
+            not SoapySDR::PreparedConverter(SOAPY_SDR_CU8, SOAPY_SDR_CF64).isInPlace())
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+
+        //other converters stage blocks of the shared buffer through scratch space,
+        //narrowing from the front and widening from the back
+        const std::pair<std::string, std::string> pairs[] = {
+            {SOAPY_SDR_CF32, SOAPY_SDR_CS16}, {SOAPY_SDR_CS16, SOAPY_SDR_CF32}, {SOAPY_SDR_CU8, SOAPY_SDR_CF64}, {SOAPY_SDR_CF64, SOAPY_SDR_CU8}};
+        for (const auto &pair : pairs)
+        {
+            //the generic narrowing converter is not in-place, so it takes the staged path too
+            const bool direct = not SoapySDR::ConverterRegistry::listPriorities(pair.first, pair.second).empty();
+            const auto conv = direct?
+                SoapySDR::PreparedConverter(pair.first, pair.second, SoapySDR::ConverterRegistry::GENERIC, 0.5):
+                SoapySDR::PreparedConverter(pair.first, pair.second, 0.5);
+            const size_t buffSize = numElems*std::max(conv.getSourceElemSize(), conv.getTargetElemSize());
+            for (const size_t numChans : {1, 2})
+            {
+                printf("  %s -> %s x%d channels ... ", pair.first.c_str(), pair.second.c_str(), int(numChans));
+                std::vector<std::vector<char>> buffs(numChans, std::vector<char>(buffSize));
+                std::vector<std::vector<char>> expected(numChans, std::vector<char>(numElems*conv.getTargetElemSize()));
+                std::vector<const void *> srcs;
+                std::vector<void *> dsts;
+                for (size_t i = 0; i < numChans; i++)
+                {
+                    fillBuffer(pair.first, buffs[i]);
+                    conv.convert(buffs[i].data(), expected[i].data(), numElems);
+                    srcs.push_back(buffs[i].data());
+                    dsts.push_back(buffs[i].data());
+                }
+                conv.convert(srcs.data(), dsts.data(), numChans, numElems);
+                for (size_t i = 0; i < numChans; i++)
+                {
+                    if (std::memcmp(buffs[i].data(), expected[i].data(), expected[i].size()) != 0)
+                    {
+                        printf("FAIL: channel %d\n", int(i));
+                        return EXIT_FAILURE;
+                    }
+                }
+                printf("OK\n");
+            }
+        }
+
+        printf("  unsized format is not staged ... ");
+        SoapySDR::ConverterRegistry unsized("UNSIZED", SOAPY_SDR_CS16, SoapySDR::ConverterRegistry::GENERIC, &unsizedConverter);
+        const SoapySDR::PreparedConverter conv("UNSIZED", SOAPY_SDR_CS16);
+        std::vector<char> buff(NUM_ELEMS*4);
+        bool thrown = false;
+        try
+        {
+            conv.convert(buff.data(), buff.data(), NUM_ELEMS);
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        if (not thrown or unsizedCalled)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+    }
+
+    printf("Check decimation:\n");
+    {
+        //the vectorized filter matches the generic one when fed in uneven chunks
+        const size_t factor = 8;
+        const std::pair<std::string, std::string> pairs[] = {
+            {SOAPY_SDR_CS16, SOAPY_SDR_CF32}, {SOAPY_SDR_CS8, SOAPY_SDR_CF32}, {SOAPY_SDR_CU8, SOAPY_SDR_CF32}};
+        for (const auto &pair : pairs)
+        {
+            printf("  %s -> %s decimate by %d ... ", pair.first.c_str(), pair.second.c_str(), int(factor));
+            std::vector<char> in(NUM_ELEMS*SoapySDR::formatToSize(pair.first));
+            std::vector<char> expected(NUM_ELEMS*SoapySDR::formatToSize(pair.second));
+            std::vector<char> out(expected.size());
+            fillBuffer(pair.first, in);
+            SoapySDR::ConverterRegistry::DecimateState generic = {};
+            const size_t numExpected = SoapySDR::ConverterRegistry::getDecimateFunction(pair.first, pair.second, SoapySDR::ConverterRegistry::GENERIC)(
+                in.data(), expected.data(), NUM_ELEMS, factor, generic, 0.5);
+
+            SoapySDR::PreparedDecimator decimator(pair.first, pair.second, factor, 0.5);
+            size_t numOut = 0;
+            for (size_t i = 0; i < NUM_ELEMS; i += 97)
+            {
+                const size_t n = std::min<size_t>(97, NUM_ELEMS-i);
+                const size_t expectedOut = decimator.getNumOutputElems(n);
+                const size_t got = decimator.decimate(in.data()+i*decimator.getSourceElemSize(), out.data()+numOut*decimator.getTargetElemSize(), n);
+                if (got != expectedOut)
+                {
+                    printf("FAIL: %d outputs, expected %d\n", int(got), int(expectedOut));
+                    return EXIT_FAILURE;
+                }
+                numOut += got;
+            }
+            if (numOut != NUM_ELEMS/factor or numExpected != numOut or
+                std::memcmp(out.data(), expected.data(), numOut*decimator.getTargetElemSize()) != 0)
+            {
+                printf("FAIL\n");
+                return EXIT_FAILURE;
+            }
+            printf("OK\n");
+        }
+
+        //a constant input settles to the same value at the output
+        printf("  unity gain at DC ... ");
+        std::vector<int16_t> in(2*64*factor);
+        for (size_t i = 0; i < in.size(); i++) in[i] = (i%2 == 0)?16384:-8192;
+        std::vector<int16_t> out(2*64);
+        SoapySDR::PreparedDecimator decimator(SOAPY_SDR_CS16, SOAPY_SDR_CS16, factor);
+        const size_t numOut = decimator.decimate(in.data(), out.data(), in.size()/2);
+        if (numOut != 64 or out[2*63+0] != 16384 or out[2*63+1] != -8192)
+        {
+            printf("FAIL: got %d outputs, %d, %d\n", int(numOut), out[2*63+0], out[2*63+1]);
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+
+        printf("  factor out of range ... ");
+        try
+        {
+            SoapySDR::PreparedDecimator(SOAPY_SDR_CS16, SOAPY_SDR_CF32, 0);
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        catch (const std::invalid_argument &)
+        {
+            printf("OK\n");
+        }
+    }
+
+    printf("Check tuning and wisdom:\n");
+    {
+        const std::string path("TestConvertersWisdom.txt");
+        const auto priority = SoapySDR::ConverterRegistry::tune(SOAPY_SDR_CS16, SOAPY_SDR_CF32);
+        const bool saved = SoapySDR::ConverterRegistry::saveWisdom(path);
+        std::ifstream file(path);
+        std::string line;
+        bool found = false;
+        while (std::getline(file, line)) found = found or (line.find(std::string(SOAPY_SDR_CS16)+" "+SOAPY_SDR_CF32+" ") == 0);
+        file.close();
+        std::remove(path.c_str());
+        printf("  CS16 -> CF32 tuned priority %d ... ", int(priority));
+        if (SoapySDR::ConverterRegistry::getSelectedPriority(SOAPY_SDR_CS16, SOAPY_SDR_CF32) != priority or
+            SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32) !=
+            SoapySDR::ConverterRegistry::getFunction(SOAPY_SDR_CS16, SOAPY_SDR_CF32, priority) or
+            SoapySDR::PreparedConverter(SOAPY_SDR_CS16, SOAPY_SDR_CF32).getPriority() != priority or
+            not saved or not found or SoapySDR::ConverterRegistry::loadWisdom(path))
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+
+        printf("  unregistered wisdom is dropped ... ");
+        SoapySDR::ConverterRegistry::saveWisdom(path);
+        std::ifstream in(path);
+        std::string wisdom;
+        while (std::getline(in, line))
+        {
+            //keep the signature so only the priority makes the entry invalid
+            const std::string prefix(std::string(SOAPY_SDR_CS16)+" "+SOAPY_SDR_CF32+" ");
+            if (line.find(prefix) != 0) continue;
+            wisdom = prefix + "4" + line.substr(line.find(' ', prefix.size())) + "\n";
+        }
+        in.close();
+        std::ofstream out(path);
+        out << wisdom;
+        out.close();
+        const bool loaded = SoapySDR::ConverterRegistry::loadWisdom(path);
+        std::remove(path.c_str());
+        if (wisdom.empty() or not loaded or SoapySDR::ConverterRegistry::getSelectedPriority(SOAPY_SDR_CS16, SOAPY_SDR_CF32) != priority)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+
+        printf("  unsized format is not tuned ... ");
+        SoapySDR::ConverterRegistry unsized0("UNSIZED", SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::GENERIC, &unsizedConverter);
+        SoapySDR::ConverterRegistry unsized1("UNSIZED", SOAPY_SDR_CF32, SoapySDR::ConverterRegistry::CUSTOM, &unsizedConverter);
+        SoapySDR::ConverterRegistry::tune();
+        bool thrown = false;
+        try
+        {
+            SoapySDR::ConverterRegistry::tune("UNSIZED", SOAPY_SDR_CF32);
+        }
+        catch (const std::runtime_error &)
+        {
+            thrown = true;
+        }
+        if (unsizedCalled or not thrown)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        printf("OK\n");
+    }
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,252 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/ConvertingStream.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <complex>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+static const size_t MTU = 64;
+static const size_t DIRECT_SIZE = 100;
+
+//a 12-bit device that only streams CS16, with or without direct access buffers,
+//receiving a ramp of I = n and Q = -n and recording the transmitted samples
+class NativeDevice : public SoapySDR::Device
+{
+public:
+    NativeDevice(const bool direct):
+        direct(direct),
+        count(0),
+        numReleases(0),
+        numCloses(0),
+        directBuff(2*DIRECT_SIZE)
+    {
+        return;
+    }
+
+    std::vector<std::string> getStreamFormats(const int, const size_t) const
+    {
+        return {SOAPY_SDR_CS16};
+    }
+
+    std::string getNativeStreamFormat(const int, const size_t, double &fullScale) const
+    {
+        fullScale = 2048;
+        return SOAPY_SDR_CS16;
+    }
+
+    SoapySDR::Stream *setupStream(const int, const std::string &format, const std::vector<size_t> &, const SoapySDR::Kwargs &)
+    {
+        if (format != SOAPY_SDR_CS16) throw std::runtime_error("unsupported format "+format);
+        return reinterpret_cast<SoapySDR::Stream *>(this);
+    }
+
+    void closeStream(SoapySDR::Stream *)
+    {
+        numCloses++;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return MTU;
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long)
+    {
+        this->fill((int16_t *)buffs[0], numElems, flags, timeNs);
+        return int(numElems);
+    }
+
+    int writeStream(SoapySDR::Stream *, const void * const *buffs, const size_t numElems, int &, const long long, const long)
+    {
+        const auto *p = (const int16_t *)buffs[0];
+        written.insert(written.end(), p, p+2*numElems);
+        return int(numElems);
+    }
+
+    size_t getNumDirectAccessBuffers(SoapySDR::Stream *)
+    {
+        return direct?1:0;
+    }
+
+    int acquireReadBuffer(SoapySDR::Stream *, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long)
+    {
+        handle = 0;
+        buffs[0] = directBuff.data();
+        this->fill(directBuff.data(), DIRECT_SIZE, flags, timeNs);
+        return int(DIRECT_SIZE);
+    }
+
+    void releaseReadBuffer(SoapySDR::Stream *, const size_t)
+    {
+        numReleases++;
+    }
+
+    int acquireWriteBuffer(SoapySDR::Stream *, size_t &handle, void **buffs, const long)
+    {
+        handle = 0;
+        buffs[0] = directBuff.data();
+        return int(DIRECT_SIZE);
+    }
+
+    void releaseWriteBuffer(SoapySDR::Stream *, const size_t, const size_t numElems, int &, const long long)
+    {
+        numReleases++;
+        written.insert(written.end(), directBuff.begin(), directBuff.begin()+2*numElems);
+    }
+
+    bool direct;
+    int count;
+    size_t numReleases;
+    size_t numCloses;
+    std::vector<int16_t> directBuff;
+    std::vector<int16_t> written;
+
+private:
+    void fill(int16_t *p, const size_t numElems, int &flags, long long &timeNs)
+    {
+        flags = SOAPY_SDR_HAS_TIME;
+        timeNs = count;
+        for (size_t j = 0; j < numElems; j++, count++)
+        {
+            p[2*j+0] = int16_t(count);
+            p[2*j+1] = int16_t(-count);
+        }
+    }
+};
+
+//read the ramp in CF32, where the 12-bit full scale maps to 1.0
+static bool checkRead(NativeDevice &device, const size_t readSize, const size_t total)
+{
+    SoapySDR::ConvertingStream stream(&device, SOAPY_SDR_RX, SOAPY_SDR_CF32);
+    if (not stream.isConverting() or stream.getStreamFormat() != SOAPY_SDR_CS16 or stream.getMTU() != MTU) return false;
+
+    std::vector<std::complex<float>> out(readSize);
+    void *buffs[1] = {out.data()};
+    for (size_t count = 0; count < total;)
+    {
+        int flags(0);
+        long long timeNs(0);
+        const int ret = stream.read(buffs, readSize, flags, timeNs);
+        if (ret <= 0) return false;
+
+        //time stamps arrive with each device buffer, which ends with a fragment
+        const size_t buffSize = device.direct?DIRECT_SIZE:readSize;
+        const bool start = (count % buffSize) == 0;
+        const bool more = ((count + ret) % buffSize) != 0;
+        if (((flags & SOAPY_SDR_HAS_TIME) != 0) != start or ((flags & SOAPY_SDR_MORE_FRAGMENTS) != 0) != more)
+        {
+            printf("FAIL: flags 0x%x at %d\n", flags, int(count));
+            return false;
+        }
+        if (start and timeNs != (long long)count) return false;
+
+        for (size_t j = 0; j < size_t(ret); j++, count++)
+        {
+            if (out[j] == std::complex<float>(count/2048.0f, -(count/2048.0f))) continue;
+            printf("FAIL: sample (%f, %f) at %d\n", out[j].real(), out[j].imag(), int(count));
+            return false;
+        }
+    }
+    return true;
+}
+
+//write CF32 0.5 which is half of the 12-bit full scale
+static bool checkWrite(NativeDevice &device, const size_t numElems, const size_t expected)
+{
+    SoapySDR::ConvertingStream stream(&device, SOAPY_SDR_TX, SOAPY_SDR_CF32);
+    std::vector<std::complex<float>> in(numElems, std::complex<float>(0.5f, -0.5f));
+    const void *buffs[1] = {in.data()};
+    int flags(SOAPY_SDR_END_BURST);
+    const int ret = stream.write(buffs, numElems, flags);
+    if (ret != int(expected) or flags != SOAPY_SDR_END_BURST) return false;
+
+    std::vector<int16_t> expectedSamps;
+    for (size_t j = 0; j < expected; j++)
+    {
+        expectedSamps.push_back(1024);
+        expectedSamps.push_back(-1024);
+    }
+    return device.written == expectedSamps;
+}
+
+int main(void)
+{
+    printf("Check convert from readStream ... ");
+    for (const size_t readSize : {size_t(MTU), size_t(10)})
+    {
+        NativeDevice device(false);
+        if (not checkRead(device, readSize, 1000) or device.numCloses != 1)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("Check convert from acquireReadBuffer ... ");
+    for (const size_t readSize : {DIRECT_SIZE, size_t(30), size_t(1000)})
+    {
+        NativeDevice device(true);
+        if (not checkRead(device, readSize, 1000) or device.numReleases != 1000/DIRECT_SIZE or device.numCloses != 1)
+        {
+            printf("FAIL: %d releases\n", int(device.numReleases));
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("Check convert to writeStream ... ");
+    {
+        NativeDevice device(false);
+        if (not checkWrite(device, 1000, MTU))
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("Check convert to acquireWriteBuffer ... ");
+    {
+        NativeDevice device(true);
+        if (not checkWrite(device, 50, 50) or device.numReleases != 1)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("Check native format ... ");
+    {
+        NativeDevice device(false);
+        SoapySDR::ConvertingStream stream(&device, SOAPY_SDR_RX, SOAPY_SDR_CS16);
+        if (stream.isConverting() or stream.getStreamFormat() != SOAPY_SDR_CS16)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("Check unknown format ... ");
+    try
+    {
+        NativeDevice device(false);
+        SoapySDR::ConvertingStream stream(&device, SOAPY_SDR_RX, "XYZ");
+        printf("FAIL\n");
+        return EXIT_FAILURE;
+    }
+    catch (const std::runtime_error &)
+    {
+        printf("OK\n");
+    }
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,359 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/Device.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Buffers.h>
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <vector>
+
+static const size_t NUM_CHANS = 2;
+static const size_t MTU = 100;
+
+//a device stream of S32 that counts up from the channel index times a million,
+//and records the first channel of transmitted samples
+class TestDevice : public SoapySDR::Device
+{
+public:
+    TestDevice(const bool useDefaults):
+        useDefaults(useDefaults),
+        count(0),
+        numReleases(0),
+        buff(NUM_CHANS, std::vector<int32_t>(MTU))
+    {
+        return;
+    }
+
+    SoapySDR::Stream *setupStream(const int, const std::string &format, const std::vector<size_t> &channels, const SoapySDR::Kwargs &)
+    {
+        auto stream = reinterpret_cast<SoapySDR::Stream *>(this);
+        if (useDefaults) this->setupDefaultStream(stream, format, channels.size());
+        return stream;
+    }
+
+    void closeStream(SoapySDR::Stream *stream)
+    {
+        this->closeDefaultStream(stream);
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return MTU;
+    }
+
+    void fill(void * const *buffs, const size_t numElems, int &flags, long long &timeNs)
+    {
+        for (size_t i = 0; i < NUM_CHANS; i++)
+        {
+            for (size_t j = 0; j < numElems; j++) ((int32_t *)buffs[i])[j] = int32_t(i*1000000 + count + j);
+        }
+        flags = SOAPY_SDR_HAS_TIME;
+        timeNs = (long long)count;
+        count += numElems;
+    }
+
+    bool useDefaults;
+    size_t count;
+    size_t numReleases;
+    std::vector<std::vector<int32_t>> buff;
+    std::vector<int32_t> written;
+    std::vector<int> writeFlags;
+};
+
+//implements only the direct buffer access API
+class DirectDevice : public TestDevice
+{
+public:
+    DirectDevice(void):
+        TestDevice(true)
+    {
+        return;
+    }
+
+    int acquireReadBuffer(SoapySDR::Stream *, size_t &handle, const void **buffs, int &flags, long long &timeNs, const long)
+    {
+        handle = 0;
+        void *ptrs[NUM_CHANS] = {buff[0].data(), buff[1].data()};
+        this->fill(ptrs, MTU, flags, timeNs);
+        for (size_t i = 0; i < NUM_CHANS; i++) buffs[i] = ptrs[i];
+        return int(MTU);
+    }
+
+    void releaseReadBuffer(SoapySDR::Stream *, const size_t)
+    {
+        numReleases++;
+    }
+
+    int acquireWriteBuffer(SoapySDR::Stream *, size_t &handle, void **buffs, const long)
+    {
+        handle = 0;
+        for (size_t i = 0; i < NUM_CHANS; i++) buffs[i] = buff[i].data();
+        return int(MTU);
+    }
+
+    void releaseWriteBuffer(SoapySDR::Stream *, const size_t, const size_t numElems, int &flags, const long long)
+    {
+        numReleases++;
+        written.insert(written.end(), buff[0].begin(), buff[0].begin()+numElems);
+        writeFlags.push_back(flags);
+    }
+};
+
+//implements only readStream() and writeStream(), 64 elements at most per write,
+//after the given number of write timeouts
+class CopyDevice : public TestDevice
+{
+public:
+    CopyDevice(void):
+        TestDevice(true),
+        numTimeouts(0)
+    {
+        return;
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long)
+    {
+        this->fill(buffs, numElems, flags, timeNs);
+        return int(numElems);
+    }
+
+    int writeStream(SoapySDR::Stream *, const void * const *buffs, const size_t numElems, int &flags, const long long, const long)
+    {
+        if (numTimeouts != 0)
+        {
+            numTimeouts--;
+            return SOAPY_SDR_TIMEOUT;
+        }
+        const size_t n = std::min<size_t>(numElems, 64);
+        const auto *p = (const int32_t *)buffs[0];
+        written.insert(written.end(), p, p+n);
+        writeFlags.push_back(flags);
+        return int(n);
+    }
+
+    size_t numTimeouts;
+};
+
+//a wrapper driver that implements readStream() with the stream of another device,
+//which bridges to the direct buffer access API of that device
+class WrapperDevice : public TestDevice
+{
+public:
+    WrapperDevice(void):
+        TestDevice(true),
+        childStream(child.setupStream(SOAPY_SDR_RX, SOAPY_SDR_S32, {0, 1}, SoapySDR::Kwargs()))
+    {
+        return;
+    }
+
+    ~WrapperDevice(void)
+    {
+        child.closeStream(childStream);
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        return child.readStream(childStream, buffs, numElems, flags, timeNs, timeoutUs);
+    }
+
+    DirectDevice child;
+    SoapySDR::Stream *childStream;
+};
+
+static bool checkSamples(const void * const *buffs, const size_t numElems, const size_t start)
+{
+    for (size_t i = 0; i < NUM_CHANS; i++)
+    {
+        for (size_t j = 0; j < numElems; j++)
+        {
+            if (((const int32_t *)buffs[i])[j] != int32_t(i*1000000 + start + j)) return false;
+        }
+    }
+    return true;
+}
+
+static std::vector<int32_t> ramp(const size_t numElems)
+{
+    std::vector<int32_t> samps(numElems);
+    for (size_t j = 0; j < numElems; j++) samps[j] = int32_t(j);
+    return samps;
+}
+
+int main(void)
+{
+    const std::vector<size_t> channels = {0, 1};
+
+    printf("Check readStream from acquireReadBuffer ... ");
+    {
+        DirectDevice device;
+        auto stream = device.setupStream(SOAPY_SDR_RX, SOAPY_SDR_S32, channels, SoapySDR::Kwargs());
+        std::vector<int32_t> out0(30), out1(30);
+        void *buffs[NUM_CHANS] = {out0.data(), out1.data()};
+
+        //each acquired buffer of 100 is read in fragments of 30, 30, 30, 10
+        for (size_t count = 0; count < 2*MTU;)
+        {
+            int flags(0);
+            long long timeNs(0);
+            const int ret = device.readStream(stream, buffs, 30, flags, timeNs);
+            const bool start = (count % MTU) == 0;
+            const bool more = ((count + ret) % MTU) != 0;
+            if (ret <= 0 or ret > 30 or not checkSamples(buffs, size_t(ret), count) or
+                ((flags & SOAPY_SDR_HAS_TIME) != 0) != start or ((flags & SOAPY_SDR_MORE_FRAGMENTS) != 0) != more or
+                (start and timeNs != (long long)count))
+            {
+                printf("FAIL: read %d with flags 0x%x at %d\n", ret, flags, int(count));
+                return EXIT_FAILURE;
+            }
+            count += size_t(ret);
+        }
+        if (device.numReleases != 2)
+        {
+            printf("FAIL: %d releases\n", int(device.numReleases));
+            return EXIT_FAILURE;
+        }
+        device.closeStream(stream);
+    }
+    printf("OK\n");
+
+    printf("Check writeStream to acquireWriteBuffer ... ");
+    {
+        DirectDevice device;
+        auto stream = device.setupStream(SOAPY_SDR_TX, SOAPY_SDR_S32, channels, SoapySDR::Kwargs());
+        const auto in = ramp(150);
+        const void *buffs[NUM_CHANS] = {in.data(), in.data()};
+        int flags(SOAPY_SDR_END_BURST);
+        const int ret0 = device.writeStream(stream, buffs, 150, flags);
+        buffs[0] = buffs[1] = in.data()+ret0;
+        const int ret1 = device.writeStream(stream, buffs, 150-ret0, flags);
+        const std::vector<int> expectedFlags = {0, SOAPY_SDR_END_BURST};
+        if (ret0 != int(MTU) or ret1 != 50 or device.written != in or device.writeFlags != expectedFlags)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        device.closeStream(stream);
+    }
+    printf("OK\n");
+
+    printf("Check acquireReadBuffer from readStream ... ");
+    {
+        CopyDevice device;
+        auto stream = device.setupStream(SOAPY_SDR_RX, SOAPY_SDR_S32, channels, SoapySDR::Kwargs());
+        for (size_t count = 0; count < 3*MTU; count += MTU)
+        {
+            size_t handle(0);
+            const void *buffs[NUM_CHANS];
+            int flags(0);
+            long long timeNs(0);
+            const int ret = device.acquireReadBuffer(stream, handle, buffs, flags, timeNs);
+            if (ret != int(MTU) or not checkSamples(buffs, MTU, count) or timeNs != (long long)count or
+                size_t(buffs[0]) % SOAPY_SDR_BUFFER_ALIGNMENT != 0)
+            {
+                printf("FAIL: acquire %d\n", ret);
+                return EXIT_FAILURE;
+            }
+            device.releaseReadBuffer(stream, handle);
+        }
+        device.closeStream(stream);
+    }
+    printf("OK\n");
+
+    printf("Check defaults of a wrapped device ... ");
+    {
+        //the acquire default of the wrapper nests the readStream default of the child
+        WrapperDevice device;
+        auto stream = device.setupStream(SOAPY_SDR_RX, SOAPY_SDR_S32, channels, SoapySDR::Kwargs());
+        size_t handle(0);
+        const void *buffs[NUM_CHANS];
+        int flags(0);
+        long long timeNs(0);
+        const int ret = device.acquireReadBuffer(stream, handle, buffs, flags, timeNs);
+        if (ret != int(MTU) or not checkSamples(buffs, MTU, 0) or device.child.numReleases != 1)
+        {
+            printf("FAIL: acquire %d\n", ret);
+            return EXIT_FAILURE;
+        }
+        device.releaseReadBuffer(stream, handle);
+        device.closeStream(stream);
+    }
+    printf("OK\n");
+
+    printf("Check acquireWriteBuffer to writeStream ... ");
+    {
+        CopyDevice device;
+        auto stream = device.setupStream(SOAPY_SDR_TX, SOAPY_SDR_S32, channels, SoapySDR::Kwargs());
+        size_t handle(0);
+        void *buffs[NUM_CHANS];
+        const int ret = device.acquireWriteBuffer(stream, handle, buffs);
+        const auto in = ramp(MTU);
+        std::copy(in.begin(), in.end(), (int32_t *)buffs[0]);
+
+        //the release is sent with two writes, and only the first has the time,
+        //and write timeouts are retried rather than dropping the buffer
+        device.numTimeouts = 2;
+        int flags(SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST);
+        device.releaseWriteBuffer(stream, handle, MTU, flags, 1000);
+        const std::vector<int> expectedFlags = {SOAPY_SDR_HAS_TIME | SOAPY_SDR_END_BURST, SOAPY_SDR_END_BURST};
+        if (ret != int(MTU) or device.written != in or device.writeFlags != expectedFlags)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+
+        //a device that never accepts the buffer drops it instead of blocking forever
+        device.acquireWriteBuffer(stream, handle, buffs);
+        device.numTimeouts = size_t(-1);
+        device.releaseWriteBuffer(stream, handle, MTU, flags, 1000);
+        if (device.written != in or device.numTimeouts != size_t(-1)-10)
+        {
+            printf("FAIL: permanent timeout\n");
+            return EXIT_FAILURE;
+        }
+        device.closeStream(stream);
+    }
+    printf("OK\n");
+
+    printf("Check unsupported streams ... ");
+    for (const bool useDefaults : {true, false})
+    {
+        //neither API is implemented, so the defaults must not recurse
+        TestDevice device(useDefaults);
+        auto stream = device.setupStream(SOAPY_SDR_RX, SOAPY_SDR_S32, channels, SoapySDR::Kwargs());
+        std::vector<int32_t> out0(MTU), out1(MTU);
+        void *buffs[NUM_CHANS] = {out0.data(), out1.data()};
+        const void *constBuffs[NUM_CHANS] = {out0.data(), out1.data()};
+        size_t handle(0);
+        int flags(0);
+        long long timeNs(0);
+        if (device.readStream(stream, buffs, MTU, flags, timeNs) != SOAPY_SDR_NOT_SUPPORTED or
+            device.writeStream(stream, constBuffs, MTU, flags) != SOAPY_SDR_NOT_SUPPORTED or
+            device.acquireReadBuffer(stream, handle, constBuffs, flags, timeNs) != SOAPY_SDR_NOT_SUPPORTED)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+        device.closeStream(stream);
+    }
+    {
+        //the defaults end with the stream, even right after a call on it
+        CopyDevice device;
+        auto stream = device.setupStream(SOAPY_SDR_TX, SOAPY_SDR_S32, channels, SoapySDR::Kwargs());
+        size_t handle(0);
+        void *buffs[NUM_CHANS];
+        const int ret = device.acquireWriteBuffer(stream, handle, buffs);
+        device.closeStream(stream);
+        if (ret != int(MTU) or device.acquireWriteBuffer(stream, handle, buffs) != SOAPY_SDR_NOT_SUPPORTED)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}
@@ -22,8 +22,10 @@ int main(void)
     formatCheck(SOAPY_SDR_CF64, 16);
     formatCheck(SOAPY_SDR_CF32, 8);
     formatCheck(SOAPY_SDR_CS32, 8);
+    formatCheck(SOAPY_SDR_CS32BE, 8);
     formatCheck(SOAPY_SDR_CU32, 8);
     formatCheck(SOAPY_SDR_CS16, 4);
+    formatCheck(SOAPY_SDR_CS16BE, 4);
     formatCheck(SOAPY_SDR_CU16, 4);
     formatCheck(SOAPY_SDR_CS12, 3);
     formatCheck(SOAPY_SDR_CU12, 3);
@@ -34,6 +36,9 @@ int main(void)
 
     formatCheck(SOAPY_SDR_F64, 8);
     formatCheck(SOAPY_SDR_F32, 4);
+    formatCheck(SOAPY_SDR_F32POW, 4);
+    formatCheck(SOAPY_SDR_F32MAG, 4);
+    formatCheck(SOAPY_SDR_F32DB, 4);
     formatCheck(SOAPY_SDR_S32, 4);
     formatCheck(SOAPY_SDR_U32, 4);
     formatCheck(SOAPY_SDR_S16, 2);
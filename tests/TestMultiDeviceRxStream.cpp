@@ -0,0 +1,165 @@
+// Copyright (c) 2026 SoapySDR contributors
+// SPDX-License-Identifier: BSL-1.0
+
+#include <SoapySDR/MultiDeviceRxStream.hpp>
+#include <SoapySDR/Formats.hpp>
+#include <SoapySDR/Errors.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+static const size_t NUM_CHANS = 2;
+static const size_t MTU = 100;
+static const double RATE = 1e6;
+
+//a receive stream at one microsecond per element with a sample of tick*4 + aggregate channel,
+//from a start tick to an end tick, which skips elements with an overflow at a drop tick
+class TickDevice : public SoapySDR::Device
+{
+public:
+    TickDevice(const size_t index, const long long startTick, const long long endTick, const long long dropTick, const long long dropLen):
+        index(index),
+        tick(startTick),
+        endTick(endTick),
+        dropTick(dropTick),
+        dropLen(dropLen)
+    {
+        return;
+    }
+
+    size_t getStreamMTU(SoapySDR::Stream *) const
+    {
+        return MTU;
+    }
+
+    int readStream(SoapySDR::Stream *, void * const *buffs, const size_t numElems, int &flags, long long &timeNs, const long timeoutUs)
+    {
+        if (tick == dropTick)
+        {
+            tick += dropLen;
+            return SOAPY_SDR_OVERFLOW;
+        }
+        if (tick >= endTick)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(timeoutUs));
+            return SOAPY_SDR_TIMEOUT;
+        }
+        long long n = std::min<long long>((long long)numElems, endTick-tick);
+        if (tick < dropTick) n = std::min(n, dropTick-tick);
+        for (size_t i = 0; i < NUM_CHANS; i++)
+        {
+            for (long long j = 0; j < n; j++) ((int32_t *)buffs[i])[j] = int32_t((tick+j)*4 + index*NUM_CHANS + i);
+        }
+        flags = SOAPY_SDR_HAS_TIME;
+        timeNs = tick*1000;
+        tick += n;
+        return int(n);
+    }
+
+    const size_t index;
+    long long tick;
+    const long long endTick;
+    const long long dropTick;
+    const long long dropLen;
+};
+
+int main(void)
+{
+    printf("Check aligned read with a gap ... ");
+    {
+        //the second device starts later and drops 150 elements at tick 3000
+        TickDevice device0(0, 1000, 5000, -1, 0);
+        TickDevice device1(1, 1037, 5000, 3000, 150);
+        std::vector<SoapySDR::Device *> devices = {&device0, &device1};
+        std::vector<SoapySDR::Stream *> streams = {nullptr, nullptr};
+        SoapySDR::MultiDeviceRxStream stream(devices, streams, SOAPY_SDR_S32, NUM_CHANS, RATE);
+        if (stream.getNumChannels() != 4 or stream.getMTU() != MTU or stream.activate() != 0)
+        {
+            printf("FAIL: setup\n");
+            return EXIT_FAILURE;
+        }
+
+        std::vector<std::vector<int32_t>> out(4, std::vector<int32_t>(64));
+        void *buffs[4] = {out[0].data(), out[1].data(), out[2].data(), out[3].data()};
+        long long expected = 1037;
+        bool gap = false;
+        while (true)
+        {
+            int flags(0);
+            long long timeNs(0);
+            const int ret = stream.read(buffs, 64, flags, timeNs, 50000);
+            if (ret == SOAPY_SDR_TIMEOUT) break;
+            if (ret == SOAPY_SDR_OVERFLOW and not gap and expected == 3000 and timeNs == 3000*1000)
+            {
+                gap = true;
+                expected = 3150;
+                continue;
+            }
+            if (ret <= 0 or (flags & SOAPY_SDR_HAS_TIME) == 0 or timeNs != expected*1000)
+            {
+                printf("FAIL: read %d at time %lld, expected %lld\n", ret, timeNs, expected*1000);
+                return EXIT_FAILURE;
+            }
+            for (size_t k = 0; k < 4; k++)
+            {
+                for (size_t j = 0; j < size_t(ret); j++)
+                {
+                    if (out[k][j] == int32_t((expected+j)*4 + k)) continue;
+                    printf("FAIL: sample %d on channel %d at tick %lld\n", int(out[k][j]), int(k), expected+(long long)j);
+                    return EXIT_FAILURE;
+                }
+            }
+            expected += ret;
+        }
+        if (not gap or expected != 5000 or stream.getNumGaps() != 1)
+        {
+            printf("FAIL: ended at tick %lld with %d gaps\n", expected, int(stream.getNumGaps()));
+            return EXIT_FAILURE;
+        }
+        stream.deactivate();
+    }
+    printf("OK\n");
+
+    printf("Check timeout without all devices ... ");
+    {
+        TickDevice device0(0, 1000, 2000, -1, 0);
+        TickDevice device1(1, 1000, 1000, -1, 0);
+        std::vector<SoapySDR::Device *> devices = {&device0, &device1};
+        std::vector<SoapySDR::Stream *> streams = {nullptr, nullptr};
+        SoapySDR::MultiDeviceRxStream stream(devices, streams, SOAPY_SDR_S32, NUM_CHANS, RATE);
+        stream.activate();
+        std::vector<int32_t> out(4*MTU);
+        void *buffs[4] = {&out[0], &out[MTU], &out[2*MTU], &out[3*MTU]};
+        int flags(0);
+        long long timeNs(0);
+        if (stream.read(buffs, MTU, flags, timeNs, 50000) != SOAPY_SDR_TIMEOUT)
+        {
+            printf("FAIL\n");
+            return EXIT_FAILURE;
+        }
+    }
+    printf("OK\n");
+
+    printf("Check invalid arguments ... ");
+    try
+    {
+        TickDevice device0(0, 0, 0, -1, 0);
+        std::vector<SoapySDR::Device *> devices = {&device0};
+        std::vector<SoapySDR::Stream *> streams = {nullptr, nullptr};
+        SoapySDR::MultiDeviceRxStream stream(devices, streams, SOAPY_SDR_S32, NUM_CHANS, RATE);
+        printf("FAIL\n");
+        return EXIT_FAILURE;
+    }
+    catch (const std::invalid_argument &)
+    {
+        printf("OK\n");
+    }
+
+    printf("DONE!\n");
+    return EXIT_SUCCESS;
+}